@@ -0,0 +1,111 @@
+#include <iostream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/fingerprint.hpp"
+#include "common/graph.hpp"
+#include "common/graph_profile.hpp"
+#include "common/subgraph.hpp"
+#include "common/tree_decomposition.hpp"
+#include "r3dp/labeling.hpp"
+#include "r3dp/lower_bounds.hpp"
+#include "r3dp/reduction.hpp"
+#include "r3dp/solver_config.hpp"
+#include "r3dp/tree_dp.hpp"
+#include "r3dp/treewidth_dp.hpp"
+
+int main(int argc, char* argv[]) {
+  // Caminho do grafo (formato "u v" por linha)
+  const std::string path = argc > 1 ? argv[1] : "data/can_24.txt";
+  Graph graph(path);
+
+  std::cout << "Grafo: " << path << " (n = " << graph.order() << ", m = " << graph.num_edges() << ")\n";
+
+  // 0. Perfil da instância e configuração dos resolvedores
+  const GraphProfile profile = profile_graph(graph);
+  SolverConfig config = select_solver_config(profile);
+  std::cout << "Graus: " << profile.min_degree << ".." << profile.max_degree << " (média " << profile.average_degree
+            << "), folhas = " << profile.leaves << ", componentes = " << profile.num_components
+            << ", triângulos = " << profile.triangles << ", agrupamento = " << profile.average_clustering
+            << ", diâmetro em [" << profile.diameter_lower << ", " << profile.diameter_upper << "]\n";
+  std::cout << "Impressão digital: " << wl_fingerprint(graph).key() << '\n';
+
+  if (config.exact == ExactStrategy::TREE_DP) {
+    Labeling labels = solve_forest(graph);
+    std::cout << "Floresta: γR3(G) = " << labeling_weight(labels) << '\n';
+    return 0;
+  }
+
+  // 1. Componentes acíclicas resolvidas exatamente pela DP em árvores; só as demais seguem adiante
+  PartialLabeling partial{Labeling(graph.order(), 0), std::vector<uint8_t>(graph.order(), 0)};
+  if (config.split_tree_components) {
+    partial = solve_tree_components(graph);
+    std::cout << "Vértices em componentes árvore: " << partial.num_fixed << " de " << graph.order() << '\n';
+    std::cout << "Peso ótimo nessas componentes: " << partial.weight << '\n';
+  }
+  std::vector<size_t> cyclic_vertices;
+  for (size_t v = 0; v < graph.order(); ++v) {
+    if (partial.fixed[v] == 0) {
+      cyclic_vertices.push_back(v);
+    }
+  }
+  const InducedSubgraph cyclic = induced_subgraph(graph, cyclic_vertices);
+
+  // 2. Regras de redução (se indicadas): o kernel é menor e guarda os vértices já atendidos
+  std::optional<Reducer> reducer;
+  const Graph* kernel = &cyclic.graph;
+  std::span<const uint8_t> kernel_satisfied;
+  size_t weight_offset = 0;
+  if (config.reduce) {
+    reducer.emplace(cyclic.graph);
+    reducer->reduce();
+    const ReductionReport& report = reducer->report();
+    kernel = &reducer->kernel();
+    kernel_satisfied = reducer->kernel_satisfied();
+    weight_offset = report.weight_offset;
+    std::cout << "\nKernel: n = " << report.kernel_vertices << ", m = " << report.kernel_edges << " ("
+              << 100.0 * report.vertex_reduction() << "% dos vértices eliminados, peso fixado = "
+              << report.weight_offset << ")\n";
+  }
+
+  // 3. Limitantes inferiores do kernel somados aos pesos fixados valem para o grafo original
+  LowerBounds bounds = compute_lower_bounds(*kernel, kernel_satisfied, 0, config.subgradient_iterations);
+  const size_t lower = bounds.best() + weight_offset + partial.weight;
+  std::cout << "Limitantes do kernel: grau = " << bounds.degree << ", empacotamento = " << bounds.packing
+            << ", PL = " << bounds.lp << " (γR3(G) >= " << lower << ")\n";
+
+  if (config.exact == ExactStrategy::NONE) {
+    std::cout << "Instância densa: resolvedor exato não indicado\n";
+    return 0;
+  }
+
+  // 4. A DP por largura só é viável se a maior bolsa do kernel couber no limite de tabela
+  TreeDecomposition td = decompose(*kernel, config.heuristic);
+  std::cout << "\nLargura da decomposição do kernel: " << td.width() << '\n';
+  if (!confirm_treewidth_dp(config, td.width())) {
+    std::cout << "Largura grande demais para a DP: resolvedor exato não indicado\n";
+    return 0;
+  }
+
+  // 5. Solução exata do kernel, levada de volta ao grafo original e unida à solução das componentes árvore
+  Labeling kernel_labels;
+  try {
+    kernel_labels = solve_nice_decomposition(*kernel, make_nice(td), kernel_satisfied);
+  } catch (const std::length_error& error) {
+    std::cout << "DP por largura interrompida: " << error.what() << '\n';
+    return 0;
+  }
+  const Labeling cyclic_labels = reducer ? reducer->lift(kernel_labels) : kernel_labels;
+  Labeling labels = std::move(partial.labels);
+  for (size_t i = 0; i < cyclic_labels.size(); ++i) {
+    labels[cyclic.to_original[i]] = cyclic_labels[i];
+  }
+  std::cout << "γR3(G) = " << labeling_weight(labels) << " (válida: " << std::boolalpha << is_r3df(graph, labels)
+            << ", gap = " << 100.0 * optimality_gap(labeling_weight(labels), lower) << "%)\n";
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <omp.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "common/random.hpp"
+
+// Compara motores xoshiro256++ contíguos (dois por linha de cache) com os fluxos alinhados do RNG,
+// dobrando o número de threads até o máximo dado.
+//
+// Aviso: o efeito do compartilhamento falso ainda não foi medido. O benchmark só foi executado em uma
+// máquina de um núcleo, onde as duas versões empatam; o ganho esperado com 32 a 64 threads depende de
+// uma execução em máquina com vários núcleos.
+
+namespace {
+
+// Números gerados por thread em cada medição
+constexpr size_t DRAWS_PER_THREAD = 1 << 26;
+
+// Tamanho do buffer de saída de cada thread
+constexpr size_t BUFFER_SIZE = 4096;
+
+// Executa DRAWS_PER_THREAD sorteios em cada thread e devolve o tempo em segundos. A saída vai para um
+// buffer de uint64_t, que pode apontar para o estado do motor, então o estado é lido e escrito na
+// memória a cada sorteio, como acontece quando o gerador é chamado no meio de um operador.
+template <typename Draw>
+double measure(int threads, Draw draw) {
+  const auto start = std::chrono::steady_clock::now();
+#pragma omp parallel num_threads(threads)
+  {
+    const int thread_id = omp_get_thread_num();
+    std::vector<uint64_t> buffer(BUFFER_SIZE);
+    for (size_t done = 0; done < DRAWS_PER_THREAD; done += BUFFER_SIZE) {
+      for (uint64_t& value : buffer) {
+        value = draw(thread_id);
+      }
+    }
+    if (buffer[0] == 0 && buffer[1] == 0) {
+      std::cout << "";  // Impede que o compilador descarte o laço
+    }
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  // Número máximo de threads (padrão: o do OpenMP)
+  const int max_threads = argc > 1 ? std::atoi(argv[1]) : omp_get_max_threads();
+
+  std::cout << "Sorteios xoshiro256++ por thread: " << DRAWS_PER_THREAD << "\n\n";
+  std::cout << "threads  contíguo (s)  alinhado (s)  ganho\n";
+
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    // Motores contíguos: 2 por linha de cache de 64 bytes
+    std::vector<Xoshiro256PlusPlus> packed;
+    for (int i = 0; i < threads; ++i) {
+      packed.emplace_back(static_cast<uint64_t>(i));
+    }
+    const double packed_time = measure(threads, [&](int thread_id) { return packed[thread_id](); });
+
+    // Motores do RNG, cada um na sua linha de cache
+    FastRNG rng(threads, 123456789);
+    const double padded_time = measure(threads, [&](int thread_id) { return rng.next_u64(thread_id); });
+
+    std::cout << threads << "  " << packed_time << "  " << padded_time << "  " << packed_time / padded_time << '\n';
+  }
+
+  return 0;
+}
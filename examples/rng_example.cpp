@@ -1,9 +1,12 @@
 #include <omp.h>
 
 #include <iostream>
+#include <sstream>
 #include <vector>
 
+#include "common/counter_rng.hpp"
 #include "common/random.hpp"
+#include "common/random_generators.hpp"
 
 int main() {
   // Número de threads a serem simuladas
@@ -74,5 +77,58 @@ int main() {
   std::cout << "Número de threads: " << rng.get_num_threads() << '\n';
   std::cout << "Semente mestre: " << rng.get_master_seed() << '\n';
 
+  // 8. Testando motores alternativos (mesma interface e mesma semeadura)
+  std::cout << "\nTestando motores alternativos:\n";
+  FastRNG fast(num_threads, seed);
+  PcgRNG pcg(num_threads, seed);
+  SplitMixRNG splitmix(num_threads, seed);
+  std::cout << "xoshiro256++: " << fast.uniform_int(0, 1, 10) << '\n';
+  std::cout << "PCG64: " << pcg.uniform_int(0, 1, 10) << '\n';
+  std::cout << "SplitMix64: " << splitmix.uniform_int(0, 1, 10) << '\n';
+
+  // 9. Testando o gerador baseado em contador (valor depende só de fluxo e contador)
+  std::cout << "\nTestando CounterRNG (fluxo = thread, contador = 0):\n";
+  CounterRNG counter_rng(seed);
+#pragma omp parallel for
+  for (int i = 0; i < num_threads; ++i) {
+    std::cout << "Fluxo " << i << ": " << counter_rng.uniform_int(i, 0, 1, 10) << '\n';
+  }
+
+  // 10. Testando local (fluxo da thread sem passar thread_id)
+  std::cout << "\nTestando local (fluxo registrado com bind):\n";
+#pragma omp parallel num_threads(num_threads)
+  {
+    rng.bind(omp_get_thread_num());
+    RNG::Stream& stream = rng.local();
+    const int value = stream.uniform_int(1, 10);
+#pragma omp critical
+    std::cout << "Thread " << omp_get_thread_num() << ": " << value << '\n';
+  }
+
+  // 11. Testando save e load (checkpoint do estado de todos os fluxos)
+  std::cout << "\nTestando save e load (mesma sequência após restaurar):\n";
+  std::stringstream checkpoint(std::ios::in | std::ios::out | std::ios::binary);
+  rng.save(checkpoint);
+  const int before = rng.uniform_int(0, 1, 1000);
+  RNG restored(num_threads, 0);
+  restored.load(checkpoint);
+  std::cout << "Original: " << before << ", restaurado: " << restored.uniform_int(0, 1, 1000) << '\n';
+
+  // 12. Testando random_regular_graph em grafos pequenos e densos (d = n - 1 e d = n - 2)
+  std::cout << "\nTestando grafos regulares densos:\n";
+  for (size_t n = 2; n <= 8; ++n) {
+    for (size_t d = n - 2; d <= n - 1; ++d) {
+      if ((n * d) % 2 != 0) {
+        continue;
+      }
+      bool regular = true;
+      for (int trial = 0; trial < 50; ++trial) {
+        const Graph graph = random_regular_graph(n, d, rng);
+        regular = regular && graph.num_edges() == n * d / 2 && graph.min_degree() == d && graph.max_degree() == d;
+      }
+      std::cout << "n = " << n << ", d = " << d << ": " << (regular ? "ok" : "FALHOU") << '\n';
+    }
+  }
+
   return 0;
 }
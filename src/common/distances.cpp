@@ -0,0 +1,235 @@
+#include "common/distances.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+
+void check_sources(const Graph& graph, std::span<const size_t> sources) {
+  if (sources.size() > MAX_BFS_SOURCES) {
+    throw std::invalid_argument("multi_source_eccentricities: mais de 64 fontes");
+  }
+  for (size_t s : sources) {
+    if (s >= graph.order()) {
+      throw std::out_of_range("multi_source_eccentricities: fonte inválida");
+    }
+  }
+}
+
+/// Acima de m / PULL_THRESHOLD arestas saindo da fronteira, o nível é feito por "pull" em paralelo.
+constexpr size_t PULL_THRESHOLD = 16;
+
+/// @brief Busca em largura bit-paralela: o bit i de uma palavra representa a fonte sources[i].
+///
+/// Cada nível escolhe a direção: com fronteira pequena os vértices da fronteira empurram seus bits
+/// ("push", sequencial); com fronteira grande cada vértice puxa os bits dos vizinhos ("pull", em
+/// paralelo). reach(level, v, bits) é chamada uma vez por vértice e nível em que v é alcançado pelas
+/// fontes de bits, possivelmente em paralelo para vértices diferentes.
+///
+/// @return Excentricidade de cada fonte.
+template <typename Reach>
+std::vector<size_t> bit_parallel_bfs(const Graph& graph, std::span<const size_t> sources, Reach reach) {
+  const size_t n = graph.order();
+  const auto count = static_cast<int64_t>(n);
+  std::vector<uint64_t> seen(n, 0);
+  std::vector<uint64_t> frontier(n, 0);
+  std::vector<uint64_t> next(n, 0);
+  std::vector<size_t> frontier_vertices;
+  std::vector<size_t> next_vertices;
+  std::vector<size_t> eccentricity(sources.size(), 0);
+
+  const uint64_t all = sources.size() == MAX_BFS_SOURCES ? ~uint64_t{0} : (uint64_t{1} << sources.size()) - 1;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    seen[sources[i]] |= uint64_t{1} << i;
+  }
+  for (size_t s : sources) {
+    if (frontier[s] == 0) {
+      frontier[s] = seen[s];
+      frontier_vertices.push_back(s);
+      reach(size_t{0}, s, seen[s]);
+    }
+  }
+
+  for (size_t level = 1; !frontier_vertices.empty(); ++level) {
+    size_t frontier_edges = 0;
+    for (size_t v : frontier_vertices) {
+      frontier_edges += graph.degree(v);
+    }
+
+    uint64_t reached = 0;
+    next_vertices.clear();
+    if (frontier_edges * PULL_THRESHOLD < 2 * graph.num_edges()) {
+      for (size_t v : frontier_vertices) {
+        for (size_t u : graph.neighbors_span(v)) {
+          const uint64_t bits = frontier[v] & ~seen[u] & ~next[u];
+          if (bits != 0) {
+            if (next[u] == 0) {
+              next_vertices.push_back(u);
+            }
+            next[u] |= bits;
+          }
+        }
+      }
+      for (size_t u : next_vertices) {
+        seen[u] |= next[u];
+        reached |= next[u];
+        reach(level, u, next[u]);
+      }
+    } else {
+#pragma omp parallel for schedule(dynamic, 1024) reduction(| : reached)
+      for (int64_t i = 0; i < count; ++i) {
+        const auto v = static_cast<size_t>(i);
+        uint64_t bits = 0;
+        if (seen[v] != all) {
+          for (size_t u : graph.neighbors_span(v)) {
+            bits |= frontier[u];
+          }
+          bits &= ~seen[v];
+        }
+        next[v] = bits;
+        if (bits != 0) {
+          seen[v] |= bits;
+          reached |= bits;
+          reach(level, v, bits);
+        }
+      }
+      for (size_t v = 0; v < n; ++v) {
+        if (next[v] != 0) {
+          next_vertices.push_back(v);
+        }
+      }
+    }
+
+    for (uint64_t bits = reached; bits != 0; bits &= bits - 1) {
+      eccentricity[static_cast<size_t>(std::countr_zero(bits))] = level;
+    }
+    // A fronteira antiga vira o próximo vetor de trabalho e precisa estar zerada
+    for (size_t v : frontier_vertices) {
+      frontier[v] = 0;
+    }
+    frontier.swap(next);
+    frontier_vertices.swap(next_vertices);
+  }
+
+  return eccentricity;
+}
+
+/// Vértice no meio de um caminho mínimo entre a (dist = distâncias a partir de a) e b.
+size_t middle_vertex(const Graph& graph, const std::vector<size_t>& dist, size_t b) {
+  const size_t target = dist[b] / 2;
+  size_t v = b;
+  while (dist[v] > target) {
+    for (size_t u : graph.neighbors_span(v)) {
+      if (dist[u] + 1 == dist[v]) {
+        v = u;
+        break;
+      }
+    }
+  }
+  return v;
+}
+
+/// Vértice mais distante de source (maior id em caso de empate) e sua distância.
+std::pair<size_t, size_t> farthest(const std::vector<size_t>& dist) {
+  size_t best = 0;
+  size_t distance = 0;
+  for (size_t v = 0; v < dist.size(); ++v) {
+    if (dist[v] != UNREACHABLE && dist[v] >= distance) {
+      best = v;
+      distance = dist[v];
+    }
+  }
+  return {best, distance};
+}
+
+}  // namespace
+
+std::vector<size_t> bfs_distances(const Graph& graph, size_t source) {
+  if (source >= graph.order()) {
+    throw std::out_of_range("bfs_distances: vértice inválido");
+  }
+  std::vector<size_t> dist(graph.order(), UNREACHABLE);
+  std::vector<size_t> queue{source};
+  dist[source] = 0;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    const size_t v = queue[head];
+    for (size_t u : graph.neighbors_span(v)) {
+      if (dist[u] == UNREACHABLE) {
+        dist[u] = dist[v] + 1;
+        queue.push_back(u);
+      }
+    }
+  }
+  return dist;
+}
+
+std::vector<size_t> multi_source_eccentricities(const Graph& graph, std::span<const size_t> sources) {
+  check_sources(graph, sources);
+  return bit_parallel_bfs(graph, sources, [](size_t, size_t, uint64_t) {});
+}
+
+EccentricityBounds eccentricity_bounds(const Graph& graph, std::span<const size_t> sources) {
+  check_sources(graph, sources);
+  const std::vector<size_t> source_eccentricity = multi_source_eccentricities(graph, sources);
+
+  EccentricityBounds bounds;
+  bounds.lower.assign(graph.order(), 0);
+  bounds.upper.assign(graph.order(), UNREACHABLE);
+  bit_parallel_bfs(graph, sources, [&](size_t level, size_t v, uint64_t bits) {
+    for (; bits != 0; bits &= bits - 1) {
+      const size_t ecc = source_eccentricity[static_cast<size_t>(std::countr_zero(bits))];
+      bounds.lower[v] = std::max({bounds.lower[v], level, ecc - level});
+      bounds.upper[v] = std::min(bounds.upper[v], level + ecc);
+    }
+  });
+  return bounds;
+}
+
+DiameterEstimate estimate_diameter(const Graph& graph, size_t source, size_t max_traversals) {
+  DiameterEstimate estimate;
+  auto sweep = [&](size_t from) {
+    ++estimate.traversals;
+    std::vector<size_t> dist = bfs_distances(graph, from);
+    const auto [far, ecc] = farthest(dist);
+    estimate.lower = std::max(estimate.lower, ecc);
+    return std::pair{std::move(dist), far};
+  };
+
+  // 4-sweep: dois double sweeps, o segundo a partir do meio do primeiro caminho
+  const size_t a1 = sweep(source).second;
+  auto [from_a1, b1] = sweep(a1);
+  const size_t a2 = sweep(middle_vertex(graph, from_a1, b1)).second;
+  auto [from_a2, b2] = sweep(a2);
+  const size_t center = middle_vertex(graph, from_a2, b2);
+
+  // iFUB: camadas da busca a partir do centro, da mais distante para a mais próxima
+  auto [from_center, far] = sweep(center);
+  size_t level = from_center[far];
+  estimate.upper = 2 * level;
+
+  std::vector<std::vector<size_t>> layers(level + 1);
+  for (size_t v = 0; v < graph.order(); ++v) {
+    if (from_center[v] != UNREACHABLE) {
+      layers[from_center[v]].push_back(v);
+    }
+  }
+
+  for (; level > 0 && estimate.lower < estimate.upper; --level) {
+    const std::vector<size_t>& layer = layers[level];
+    for (size_t begin = 0; begin < layer.size(); begin += MAX_BFS_SOURCES) {
+      if (estimate.traversals >= max_traversals) {
+        return estimate;
+      }
+      ++estimate.traversals;
+      const size_t end = std::min(layer.size(), begin + MAX_BFS_SOURCES);
+      for (size_t ecc : multi_source_eccentricities(graph, std::span(layer).subspan(begin, end - begin))) {
+        estimate.lower = std::max(estimate.lower, ecc);
+      }
+    }
+    // Todo par restante está a distância no máximo 2(level - 1) passando pelo centro
+    estimate.upper = std::max(estimate.lower, 2 * (level - 1));
+  }
+  return estimate;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Distância de vértices não alcançados.
+inline constexpr size_t UNREACHABLE = std::numeric_limits<size_t>::max();
+
+/// @brief Máximo de fontes por busca bit-paralela (uma por bit de uma palavra de 64 bits).
+inline constexpr size_t MAX_BFS_SOURCES = 64;
+
+/// @brief Máximo padrão de buscas em estimate_diameter().
+inline constexpr size_t DEFAULT_DIAMETER_TRAVERSALS = 32;
+
+/// @brief Distâncias a partir de uma fonte por busca em largura.
+/// @param graph Grafo.
+/// @param source Vértice de origem.
+/// @return Distância de cada vértice (UNREACHABLE fora da componente de source).
+/// @throws std::out_of_range Se source for inválido.
+[[nodiscard]] std::vector<size_t> bfs_distances(const Graph& graph, size_t source);
+
+/// @brief Excentricidades de até 64 fontes com uma única busca bit-paralela.
+///
+/// Cada vértice guarda uma palavra com um bit por fonte; um nível da busca é um OR das palavras da
+/// fronteira dos vizinhos, paralelizado com OpenMP. Vértices já alcançados por todas as fontes são
+/// ignorados, então o custo é O(m) por nível enquanto a busca está ativa.
+///
+/// @param graph Grafo.
+/// @param sources Fontes (no máximo MAX_BFS_SOURCES).
+/// @return Excentricidade de cada fonte dentro da sua componente.
+/// @throws std::invalid_argument Se houver mais de MAX_BFS_SOURCES fontes.
+/// @throws std::out_of_range Se alguma fonte for inválida.
+[[nodiscard]] std::vector<size_t> multi_source_eccentricities(const Graph& graph, std::span<const size_t> sources);
+
+/// @brief Limitantes de excentricidade de todos os vértices.
+struct EccentricityBounds {
+  std::vector<size_t> lower;  ///< ecc(v) >= lower[v]
+  std::vector<size_t> upper;  ///< ecc(v) <= upper[v] (UNREACHABLE se nenhuma fonte alcança v)
+};
+
+/// @brief Limita a excentricidade de todos os vértices a partir de até 64 fontes.
+///
+/// Usa max(d(s, v), ecc(s) - d(s, v)) <= ecc(v) <= d(s, v) + ecc(s) para cada fonte s da componente
+/// de v. São duas buscas bit-paralelas: uma para as excentricidades das fontes e outra para os limites.
+///
+/// @param graph Grafo.
+/// @param sources Fontes (no máximo MAX_BFS_SOURCES).
+/// @return Limitantes inferior e superior de cada vértice.
+/// @throws std::invalid_argument Se houver mais de MAX_BFS_SOURCES fontes.
+/// @throws std::out_of_range Se alguma fonte for inválida.
+[[nodiscard]] EccentricityBounds eccentricity_bounds(const Graph& graph, std::span<const size_t> sources);
+
+/// @brief Intervalo que contém o diâmetro de uma componente.
+struct DiameterEstimate {
+  size_t lower = 0;
+  size_t upper = 0;
+  size_t traversals = 0;  ///< Buscas executadas (uma busca bit-paralela conta como uma)
+
+  /// @brief Indica se o diâmetro foi determinado exatamente.
+  [[nodiscard]] bool is_exact() const noexcept { return lower == upper; }
+};
+
+/// @brief Estima o diâmetro da componente de source com 4-sweep e iFUB.
+///
+/// O 4-sweep dá um limitante inferior e um vértice central u. O iFUB percorre as camadas da busca a
+/// partir de u da mais distante para a mais próxima, calculando as excentricidades de cada camada em
+/// lotes de 64 com a busca bit-paralela; ao terminar a camada i o diâmetro fica limitado por
+/// max(inferior, 2(i - 1)). Para quando os limites se encontram ou após max_traversals buscas.
+///
+/// @param graph Grafo.
+/// @param source Vértice da componente analisada.
+/// @param max_traversals Máximo de buscas.
+/// @return Limitantes do diâmetro da componente.
+/// @throws std::out_of_range Se source for inválido.
+[[nodiscard]] DiameterEstimate estimate_diameter(const Graph& graph, size_t source,
+                                                 size_t max_traversals = DEFAULT_DIAMETER_TRAVERSALS);
@@ -0,0 +1,257 @@
+#include "common/dynamic_graph.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// Vértices visitados por lado na busca local que tenta reconectar os extremos de uma aresta removida.
+constexpr size_t LOCAL_SEARCH_LIMIT = 64;
+
+}  // namespace
+
+DynamicGraph::DynamicGraph(Graph graph)
+    : graph_(std::move(graph)),
+      parent_(graph_.order()),
+      members_(graph_.order()),
+      dirty_(graph_.order(), 0),
+      visited_(graph_.order(), 0) {
+  for (size_t v = 0; v < graph_.order(); ++v) {
+    parent_[v] = v;
+    members_[v].push_back(v);
+  }
+  num_components_ = graph_.order();
+
+  // Sem remoções, unir os extremos de cada aresta já dá a partição exata
+  for (size_t v = 0; v < graph_.order(); ++v) {
+    for (size_t u : graph_.neighbors_span(v)) {
+      if (u > v) {
+        unite(u, v);
+      }
+    }
+  }
+}
+
+size_t DynamicGraph::find(size_t v) noexcept {
+  while (parent_[v] != v) {
+    parent_[v] = parent_[parent_[v]];
+    v = parent_[v];
+  }
+  return v;
+}
+
+void DynamicGraph::unite(size_t a, size_t b) {
+  a = find(a);
+  b = find(b);
+  if (a == b) {
+    return;
+  }
+  if (members_[a].size() < members_[b].size()) {
+    std::swap(a, b);
+  }
+  parent_[b] = a;
+  members_[a].insert(members_[a].end(), members_[b].begin(), members_[b].end());
+  members_[b].clear();
+  members_[b].shrink_to_fit();
+  if (dirty_[b] != 0) {
+    if (dirty_[a] == 0) {
+      dirty_[a] = 1;
+      dirty_roots_.push_back(a);
+    } else {
+      --num_dirty_;
+    }
+    dirty_[b] = 0;
+  }
+  --num_components_;
+}
+
+void DynamicGraph::mark_dirty(size_t v) {
+  const size_t root = find(v);
+  if (dirty_[root] == 0) {
+    dirty_[root] = 1;
+    dirty_roots_.push_back(root);
+    ++num_dirty_;
+  }
+}
+
+size_t DynamicGraph::add_vertex() {
+  const size_t v = graph_.order();
+  graph_.add_vertex(v);
+  parent_.push_back(v);
+  members_.push_back({v});
+  dirty_.push_back(0);
+  visited_.push_back(0);
+  ++num_components_;
+  return v;
+}
+
+void DynamicGraph::insert_edge(size_t u, size_t v) {
+  graph_.add_edge(u, v);
+  unite(u, v);
+}
+
+void DynamicGraph::remove_edge(size_t u, size_t v) {
+  if (u >= graph_.order() || v >= graph_.order()) {
+    throw std::out_of_range("DynamicGraph::remove_edge: vértice inválido");
+  }
+  if (graph_.has_edge(u, v)) {
+    graph_.remove_edge(u, v);
+    update_after_removal(u, v);
+  }
+}
+
+void DynamicGraph::update_after_removal(size_t u, size_t v) {
+  const size_t from_u = ++epoch_;
+  const size_t from_v = ++epoch_;
+  std::vector<size_t> queue_u{u};
+  std::vector<size_t> queue_v{v};
+  visited_[u] = from_u;
+  visited_[v] = from_v;
+
+  // Expande um vértice de cada lado por vez; devolve true se as buscas se encontrarem
+  auto expand = [&](std::vector<size_t>& queue, size_t& head, size_t mine, size_t other) {
+    const size_t x = queue[head++];
+    for (size_t y : graph_.neighbors_span(x)) {
+      if (visited_[y] == other) {
+        return true;
+      }
+      if (visited_[y] != mine) {
+        visited_[y] = mine;
+        queue.push_back(y);
+      }
+    }
+    return false;
+  };
+
+  size_t head_u = 0;
+  size_t head_v = 0;
+  while (head_u < queue_u.size() && head_v < queue_v.size() && head_u < LOCAL_SEARCH_LIMIT) {
+    if (expand(queue_u, head_u, from_u, from_v) || expand(queue_v, head_v, from_v, from_u)) {
+      return;
+    }
+  }
+
+  // Um lado esgotado sem encontrar o outro é a nova componente inteira
+  if (head_u == queue_u.size()) {
+    split_off(queue_u);
+  } else if (head_v == queue_v.size()) {
+    split_off(queue_v);
+  } else {
+    mark_dirty(u);
+  }
+}
+
+void DynamicGraph::split_off(const std::vector<size_t>& side) {
+  const size_t root = find(side.front());
+  ++epoch_;
+  for (size_t x : side) {
+    visited_[x] = epoch_;
+  }
+
+  // O restante fica com a raiz antiga, ou com outro membro se ela saiu junto com side, e herda a marca
+  std::vector<size_t> rest = std::move(members_[root]);
+  members_[root].clear();
+  std::erase_if(rest, [&](size_t x) { return visited_[x] == epoch_; });
+  const size_t rest_root = visited_[root] == epoch_ ? rest.front() : root;
+  const uint8_t was_dirty = dirty_[root];
+  dirty_[root] = 0;
+  for (size_t x : rest) {
+    parent_[x] = rest_root;  // Caminhos antigos podem passar por vértices de side
+  }
+  members_[rest_root] = std::move(rest);
+  dirty_[rest_root] = was_dirty;
+  if (was_dirty != 0 && rest_root != root) {
+    dirty_roots_.push_back(rest_root);
+  }
+
+  // side foi obtido por uma busca completa: é uma componente exata
+  const size_t side_root = side.front();
+  for (size_t x : side) {
+    parent_[x] = side_root;
+  }
+  members_[side_root] = side;
+  dirty_[side_root] = 0;
+  ++num_components_;
+}
+
+void DynamicGraph::apply(std::span<const EdgeUpdate> updates) {
+  for (const EdgeUpdate& update : updates) {
+    if (update.type == UpdateType::INSERT) {
+      insert_edge(update.u, update.v);
+    } else {
+      remove_edge(update.u, update.v);
+    }
+  }
+}
+
+void DynamicGraph::refresh() {
+  std::vector<size_t> component;
+  std::vector<size_t> queue;
+
+  for (size_t marked : dirty_roots_) {
+    const size_t root = find(marked);
+    if (dirty_[root] == 0) {
+      continue;  // Já recalculada ou entrada obsoleta
+    }
+    dirty_[root] = 0;
+    --num_dirty_;
+    component = std::move(members_[root]);
+    members_[root].clear();
+    for (size_t v : component) {
+      parent_[v] = v;
+    }
+    --num_components_;
+
+    // Busca em largura restrita aos membros: arestas nunca saem da componente da union-find
+    ++epoch_;
+    for (size_t start : component) {
+      if (visited_[start] == epoch_) {
+        continue;
+      }
+      visited_[start] = epoch_;
+      queue.assign(1, start);
+      for (size_t head = 0; head < queue.size(); ++head) {
+        const size_t v = queue[head];
+        parent_[v] = start;
+        for (size_t u : graph_.neighbors_span(v)) {
+          if (visited_[u] != epoch_) {
+            visited_[u] = epoch_;
+            queue.push_back(u);
+          }
+        }
+      }
+      members_[start] = queue;
+      ++num_components_;
+    }
+  }
+  dirty_roots_.clear();
+}
+
+size_t DynamicGraph::num_components() {
+  refresh();
+  return num_components_;
+}
+
+bool DynamicGraph::is_connected() { return num_components() <= 1; }
+
+size_t DynamicGraph::component_of(size_t v) {
+  if (v >= graph_.order()) {
+    throw std::out_of_range("DynamicGraph::component_of: vértice inválido");
+  }
+  refresh();
+  return find(v);
+}
+
+bool DynamicGraph::connected(size_t u, size_t v) {
+  if (u >= graph_.order() || v >= graph_.order()) {
+    throw std::out_of_range("DynamicGraph::connected: vértice inválido");
+  }
+  // A partição da union-find é mais grossa: conjuntos diferentes já provam a desconexão
+  if (find(u) != find(v)) {
+    return false;
+  }
+  refresh();
+  return find(u) == find(v);
+}
+
+std::span<const size_t> DynamicGraph::component_members(size_t v) { return members_[component_of(v)]; }
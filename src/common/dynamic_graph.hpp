@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Tipo de uma atualização de aresta.
+enum class UpdateType {
+  INSERT,  ///< Insere a aresta (nada acontece se já existir)
+  REMOVE,  ///< Remove a aresta (nada acontece se não existir)
+};
+
+/// @brief Atualização de aresta aplicada em lote por DynamicGraph::apply().
+struct EdgeUpdate {
+  UpdateType type;
+  size_t u;
+  size_t v;
+};
+
+/// @brief Grafo com conectividade mantida incrementalmente.
+///
+/// As componentes ficam em uma union-find (união por tamanho, compressão por halving) que guarda a
+/// lista de membros de cada raiz. Inserções só unem conjuntos. Uma remoção primeiro tenta reconectar
+/// os extremos com duas buscas locais limitadas. Se uma das buscas esgotar o seu lado sem encontrar a
+/// outra, a partição é certa e a componente é dividida na hora; se ambas atingirem o limite, a
+/// componente é marcada como suja, já que ela pode ter se partido. Componentes sujas são recalculadas por busca em largura apenas sobre
+/// os próprios membros, na próxima consulta, então várias remoções na mesma componente (como em um
+/// lote) custam uma única busca.
+///
+/// A partição da union-find é sempre igual ou mais grossa que a real, e exata nas componentes limpas.
+class DynamicGraph {
+ private:
+  Graph graph_;
+  std::vector<size_t> parent_;
+  std::vector<std::vector<size_t>> members_;  ///< Membros de cada raiz (vazio nos demais vértices)
+  std::vector<uint8_t> dirty_;                ///< dirty_[r] != 0 se a componente de raiz r pode ter se partido
+  std::vector<size_t> dirty_roots_;           ///< Raízes marcadas (podem ter deixado de ser raízes)
+  std::vector<size_t> visited_;               ///< Época da última busca que visitou cada vértice
+  size_t epoch_ = 0;
+  size_t num_components_ = 0;
+  size_t num_dirty_ = 0;
+
+  size_t find(size_t v) noexcept;
+  void unite(size_t a, size_t b);
+  void mark_dirty(size_t v);
+  void update_after_removal(size_t u, size_t v);
+  void split_off(const std::vector<size_t>& side);
+
+ public:
+  /// @brief Assume o grafo e calcula as componentes iniciais.
+  /// @param graph Grafo inicial.
+  explicit DynamicGraph(Graph graph);
+
+  /// @brief Grafo atual.
+  [[nodiscard]] const Graph& graph() const noexcept { return graph_; }
+
+  /// @brief Adiciona um vértice isolado.
+  /// @return Id do novo vértice.
+  size_t add_vertex();
+
+  /// @brief Insere a aresta {u, v} e une as componentes.
+  /// @throws std::out_of_range Se u ou v forem inválidos.
+  /// @throws std::invalid_argument Se u == v.
+  void insert_edge(size_t u, size_t v);
+
+  /// @brief Remove a aresta {u, v} e marca a componente como suja.
+  /// @throws std::out_of_range Se u ou v forem inválidos.
+  void remove_edge(size_t u, size_t v);
+
+  /// @brief Aplica um lote de atualizações em ordem; a conectividade só é recalculada na próxima consulta.
+  /// @param updates Atualizações.
+  /// @throws std::out_of_range Se algum vértice for inválido.
+  /// @throws std::invalid_argument Se alguma inserção for um self-loop.
+  void apply(std::span<const EdgeUpdate> updates);
+
+  /// @brief Recalcula as componentes sujas.
+  void refresh();
+
+  /// @brief Número de componentes conexas.
+  [[nodiscard]] size_t num_components();
+
+  /// @brief Determina se o grafo é conexo (o grafo vazio é conexo).
+  [[nodiscard]] bool is_connected();
+
+  /// @brief Representante da componente de v (muda quando componentes se unem ou se partem).
+  /// @throws std::out_of_range Se v for inválido.
+  [[nodiscard]] size_t component_of(size_t v);
+
+  /// @brief Indica se u e v estão na mesma componente.
+  /// @throws std::out_of_range Se u ou v forem inválidos.
+  [[nodiscard]] bool connected(size_t u, size_t v);
+
+  /// @brief Vértices da componente de v, na ordem interna.
+  /// @throws std::out_of_range Se v for inválido.
+  [[nodiscard]] std::span<const size_t> component_members(size_t v);
+
+  /// @brief Número de componentes aguardando recálculo.
+  [[nodiscard]] size_t num_dirty_components() const noexcept { return num_dirty_; }
+};
@@ -0,0 +1,84 @@
+#include "common/fingerprint.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <vector>
+
+namespace {
+
+/// Finalizador do SplitMix64.
+constexpr uint64_t mix(uint64_t x) noexcept {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/// Separa a contribuição dos vizinhos da cor do próprio vértice.
+constexpr uint64_t NEIGHBOR_SALT = 0x5851f42d4c957f2dULL;
+
+size_t count_distinct(const std::vector<uint64_t>& colors, std::vector<uint64_t>& buffer) {
+  buffer.assign(colors.begin(), colors.end());
+  std::sort(buffer.begin(), buffer.end());
+  return static_cast<size_t>(std::unique(buffer.begin(), buffer.end()) - buffer.begin());
+}
+
+}  // namespace
+
+std::string GraphFingerprint::key() const {
+  char hex[16];
+  const auto end = std::to_chars(hex, hex + sizeof(hex), hash, 16).ptr;
+  const auto digits = static_cast<size_t>(end - hex);
+
+  std::string key;
+  key.reserve(48);
+  key.append("n").append(std::to_string(vertices));
+  key.append("-m").append(std::to_string(edges));
+  key.append("-").append(16 - digits, '0').append(hex, digits);
+  return key;
+}
+
+GraphFingerprint wl_fingerprint(const Graph& graph, size_t max_rounds) {
+  const size_t n = graph.order();
+  GraphFingerprint fingerprint{n, graph.num_edges()};
+
+  std::vector<uint64_t> colors(n);
+  std::vector<uint64_t> next(n);
+  std::vector<uint64_t> buffer;
+  const auto count = static_cast<int64_t>(n);
+
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < count; ++i) {
+    colors[static_cast<size_t>(i)] = mix(graph.degree(static_cast<size_t>(i)));
+  }
+  fingerprint.classes = count_distinct(colors, buffer);
+
+  while (fingerprint.rounds < max_rounds && fingerprint.classes < n) {
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int64_t i = 0; i < count; ++i) {
+      const auto v = static_cast<size_t>(i);
+      uint64_t neighborhood = 0;
+      for (size_t u : graph.neighbors_span(v)) {
+        neighborhood += mix(colors[u] ^ NEIGHBOR_SALT);
+      }
+      next[v] = mix(colors[v] ^ mix(neighborhood));
+    }
+    colors.swap(next);
+    ++fingerprint.rounds;
+
+    const size_t classes = count_distinct(colors, buffer);
+    const bool stable = classes == fingerprint.classes;
+    fingerprint.classes = classes;
+    if (stable) {
+      break;
+    }
+  }
+
+  uint64_t multiset = 0;
+#pragma omp parallel for schedule(static) reduction(+ : multiset)
+  for (int64_t i = 0; i < count; ++i) {
+    multiset += mix(colors[static_cast<size_t>(i)]);
+  }
+  fingerprint.hash = mix(mix(n) ^ mix(fingerprint.edges + NEIGHBOR_SALT) ^ multiset);
+  return fingerprint;
+}
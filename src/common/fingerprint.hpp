@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "common/graph.hpp"
+
+/// @brief Máximo padrão de rodadas de refinamento de cores.
+inline constexpr size_t DEFAULT_WL_ROUNDS = 16;
+
+/// @brief Impressão digital de um grafo, invariante por renomeação dos vértices.
+///
+/// Grafos isomorfos sempre têm a mesma impressão digital. O contrário não vale: grafos que o
+/// refinamento 1-WL não distingue (por exemplo, dois grafos d-regulares com o mesmo n) colidem, assim
+/// como, com probabilidade desprezível, grafos quaisquer por colisão de hash.
+struct GraphFingerprint {
+  size_t vertices = 0;
+  size_t edges = 0;
+  size_t rounds = 0;   ///< Rodadas executadas até a partição estabilizar (ou até o limite)
+  size_t classes = 0;  ///< Número de cores distintas na partição final
+  uint64_t hash = 0;   ///< Hash do multiconjunto de cores finais
+
+  /// @brief Chave textual "n<vertices>-m<edges>-<hash em hexadecimal>", própria para nomes de arquivo.
+  [[nodiscard]] std::string key() const;
+
+  [[nodiscard]] bool operator==(const GraphFingerprint& other) const noexcept {
+    return vertices == other.vertices && edges == other.edges && hash == other.hash;
+  }
+};
+
+/// @brief Impressão digital por refinamento de cores de Weisfeiler–Lehman (1-WL).
+///
+/// A cor inicial de cada vértice é o seu grau; a cada rodada, a nova cor é um hash da cor atual com o
+/// multiconjunto das cores dos vizinhos (soma de um embaralhamento de cada cor, como em
+/// neighborhood_fingerprint(), sem ordenar). As rodadas são paralelas sobre os vértices (OpenMP) e param
+/// quando o número de cores distintas deixa de crescer ou após max_rounds. Custo O(rounds * (n log n + m)).
+///
+/// O hash usa apenas aritmética de 64 bits com constantes fixas, então é estável entre execuções e
+/// máquinas e pode servir de chave para reaproveitar resultados de resolvedores. Só valores invariantes
+/// (como γR3(G)) podem ser reaproveitados diretamente; rotulações dependem da numeração dos vértices.
+///
+/// @param graph Grafo.
+/// @param max_rounds Limite de rodadas de refinamento.
+/// @return Impressão digital do grafo.
+[[nodiscard]] GraphFingerprint wl_fingerprint(const Graph& graph, size_t max_rounds = DEFAULT_WL_ROUNDS);
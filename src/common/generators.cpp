@@ -0,0 +1,144 @@
+#include "common/generators.hpp"
+
+#include <cstdint>
+
+namespace {
+
+enum class ProductType { CARTESIAN, DIRECT, STRONG };
+
+Graph product(const Graph& g, const Graph& h, ProductType type) {
+  const size_t ng = g.order();
+  const size_t nh = h.order();
+  const bool cartesian = type != ProductType::DIRECT;
+  const bool direct = type != ProductType::CARTESIAN;
+
+  std::vector<std::vector<size_t>> adjacency(ng * nh);
+  const auto count = static_cast<int64_t>(ng);
+
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto a = static_cast<size_t>(i);
+    const auto ga = g.neighbors_span(a);
+    for (size_t b = 0; b < nh; ++b) {
+      const auto hb = h.neighbors_span(b);
+      std::vector<size_t>& neighbors = adjacency[a * nh + b];
+      neighbors.reserve((cartesian ? ga.size() + hb.size() : 0) + (direct ? ga.size() * hb.size() : 0));
+
+      if (cartesian) {
+        for (size_t b2 : hb) {
+          neighbors.push_back(a * nh + b2);
+        }
+        for (size_t a2 : ga) {
+          neighbors.push_back(a2 * nh + b);
+        }
+      }
+      if (direct) {
+        for (size_t a2 : ga) {
+          for (size_t b2 : hb) {
+            neighbors.push_back(a2 * nh + b2);
+          }
+        }
+      }
+    }
+  }
+
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+}  // namespace
+
+Graph path_graph(size_t n) {
+  std::vector<std::vector<size_t>> adjacency(n);
+  for (size_t v = 0; v + 1 < n; ++v) {
+    adjacency[v].push_back(v + 1);
+    adjacency[v + 1].push_back(v);
+  }
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+Graph cycle_graph(size_t n) {
+  if (n < 3) {
+    return path_graph(n);
+  }
+  std::vector<std::vector<size_t>> adjacency(n);
+  for (size_t v = 0; v < n; ++v) {
+    adjacency[v] = {(v + n - 1) % n, (v + 1) % n};
+  }
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+Graph complete_graph(size_t n) {
+  std::vector<std::vector<size_t>> adjacency(n);
+  const auto count = static_cast<int64_t>(n);
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto v = static_cast<size_t>(i);
+    adjacency[v].reserve(n - 1);
+    for (size_t u = 0; u < n; ++u) {
+      if (u != v) {
+        adjacency[v].push_back(u);
+      }
+    }
+  }
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+Graph cartesian_product(const Graph& g, const Graph& h) { return product(g, h, ProductType::CARTESIAN); }
+
+Graph direct_product(const Graph& g, const Graph& h) { return product(g, h, ProductType::DIRECT); }
+
+Graph strong_product(const Graph& g, const Graph& h) { return product(g, h, ProductType::STRONG); }
+
+Graph grid_graph(size_t rows, size_t cols) { return cartesian_product(path_graph(rows), path_graph(cols)); }
+
+Graph cylinder_graph(size_t rows, size_t cols) { return cartesian_product(path_graph(rows), cycle_graph(cols)); }
+
+Graph torus_graph(size_t rows, size_t cols) { return cartesian_product(cycle_graph(rows), cycle_graph(cols)); }
+
+std::vector<std::pair<size_t, size_t>> edge_list(const Graph& graph) {
+  std::vector<std::pair<size_t, size_t>> edges;
+  edges.reserve(graph.num_edges());
+  for (size_t u = 0; u < graph.order(); ++u) {
+    for (size_t v : graph.neighbors_span(u)) {
+      if (u < v) {
+        edges.emplace_back(u, v);
+      }
+    }
+  }
+  return edges;
+}
+
+Graph line_graph(const Graph& graph) {
+  const std::vector<std::pair<size_t, size_t>> edges = edge_list(graph);
+
+  // Arestas incidentes a cada vértice em CSR
+  std::vector<size_t> offsets(graph.order() + 1, 0);
+  for (size_t v = 0; v < graph.order(); ++v) {
+    offsets[v + 1] = offsets[v] + graph.degree(v);
+  }
+  std::vector<size_t> incident(offsets.back());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t e = 0; e < edges.size(); ++e) {
+    incident[next[edges[e].first]++] = e;
+    incident[next[edges[e].second]++] = e;
+  }
+
+  std::vector<std::vector<size_t>> adjacency(edges.size());
+  const auto count = static_cast<int64_t>(edges.size());
+#pragma omp parallel for schedule(dynamic, 256)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto e = static_cast<size_t>(i);
+    const auto [u, v] = edges[e];
+    std::vector<size_t>& neighbors = adjacency[e];
+    neighbors.reserve(graph.degree(u) + graph.degree(v) - 2);
+    for (size_t endpoint : {u, v}) {
+      for (size_t k = offsets[endpoint]; k < offsets[endpoint + 1]; ++k) {
+        if (incident[k] != e) {
+          neighbors.push_back(incident[k]);
+        }
+      }
+    }
+  }
+
+  return Graph::from_adjacency(std::move(adjacency));
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Caminho P_n: 0 - 1 - ... - (n-1).
+[[nodiscard]] Graph path_graph(size_t n);
+
+/// @brief Ciclo C_n (para n < 3 devolve o caminho P_n, já que o grafo é simples).
+[[nodiscard]] Graph cycle_graph(size_t n);
+
+/// @brief Grafo completo K_n.
+[[nodiscard]] Graph complete_graph(size_t n);
+
+/// @brief Produto cartesiano G □ H.
+///
+/// O vértice (a, b) recebe o id a * |V(H)| + b; (a, b) ~ (a', b') se a = a' e b ~ b' ou a ~ a' e b = b'.
+/// As listas são montadas já com o tamanho final, em paralelo sobre os vértices de G (OpenMP).
+///
+/// @param g Primeiro fator.
+/// @param h Segundo fator.
+/// @return Produto com |V(G)| * |V(H)| vértices.
+[[nodiscard]] Graph cartesian_product(const Graph& g, const Graph& h);
+
+/// @brief Produto direto (tensorial) G × H: (a, b) ~ (a', b') se a ~ a' e b ~ b'.
+/// @param g Primeiro fator.
+/// @param h Segundo fator.
+/// @return Produto com a mesma numeração de cartesian_product().
+[[nodiscard]] Graph direct_product(const Graph& g, const Graph& h);
+
+/// @brief Produto forte G ⊠ H: união dos produtos cartesiano e direto.
+/// @param g Primeiro fator.
+/// @param h Segundo fator.
+/// @return Produto com a mesma numeração de cartesian_product().
+[[nodiscard]] Graph strong_product(const Graph& g, const Graph& h);
+
+/// @brief Grade P_rows □ P_cols; o vértice (i, j) recebe o id i * cols + j.
+[[nodiscard]] Graph grid_graph(size_t rows, size_t cols);
+
+/// @brief Cilindro P_rows □ C_cols.
+[[nodiscard]] Graph cylinder_graph(size_t rows, size_t cols);
+
+/// @brief Toro C_rows □ C_cols.
+[[nodiscard]] Graph torus_graph(size_t rows, size_t cols);
+
+/// @brief Arestas {u, v} com u < v, em ordem crescente de u e, para cada u, na ordem de adjacência.
+/// @param graph Grafo.
+/// @return Lista com graph.num_edges() arestas.
+[[nodiscard]] std::vector<std::pair<size_t, size_t>> edge_list(const Graph& graph);
+
+/// @brief Grafo linha L(G): um vértice por aresta, adjacentes se as arestas compartilham um extremo.
+///
+/// O vértice i de L(G) é a aresta edge_list(graph)[i]. As arestas incidentes a cada vértice ficam em
+/// formato CSR e as listas de L(G) são montadas em paralelo, em O(soma de d(v)^2).
+///
+/// @param graph Grafo.
+/// @return Grafo linha com graph.num_edges() vértices.
+[[nodiscard]] Graph line_graph(const Graph& graph);
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
 #include <span>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 /// @brief Representa um grafo simples (não-dirigido, sem pesos) usando lista de adjacência.
@@ -21,6 +24,9 @@ class Graph {
   std::vector<std::vector<size_t>> adj_list_;
 
  public:
+  /// @brief Marca, no mapeamento devolvido por remove_vertices(), um vértice removido.
+  static constexpr size_t REMOVED_VERTEX = std::numeric_limits<size_t>::max();
+
   /// @brief Construtor padrão. Cria um grafo vazio.
   Graph() noexcept;
 
@@ -37,13 +43,32 @@ class Graph {
   /// @throws std::runtime_error Se o arquivo não puder ser aberto ou estiver malformado.
   explicit Graph(const std::string& filepath);
 
+  /// @brief Constrói o grafo diretamente a partir de listas de adjacência, sem verificações por aresta.
+  ///
+  /// Usado por quem já produz listas válidas (subgrafos, compactações) e quer evitar o custo de
+  /// add_edge(), que procura a aresta antes de inserir.
+  ///
+  /// @param adjacency adjacency[v] = vizinhos de v; deve ser simétrica, sem self-loops e sem repetições.
+  /// @return Grafo com adjacency.size() vértices.
+  [[nodiscard]] static Graph from_adjacency(std::vector<std::vector<size_t>> adjacency) {
+    Graph graph;
+    graph.num_vertices_ = adjacency.size();
+    graph.num_edges_ = 0;
+    for (const auto& neighbors : adjacency) {
+      graph.num_edges_ += neighbors.size();
+    }
+    graph.num_edges_ /= 2;
+    graph.adj_list_ = std::move(adjacency);
+    return graph;
+  }
+
   /// @brief Retorna o número de vértices.
   /// @return Número de vértices.
-  [[nodiscard]] constexpr size_t order() const noexcept;
+  [[nodiscard]] constexpr size_t order() const noexcept { return num_vertices_; }
 
   /// @brief Retorna o número de arestas.
   /// @return Número de arestas.
-  [[nodiscard]] constexpr size_t num_edges() const noexcept;
+  [[nodiscard]] constexpr size_t num_edges() const noexcept { return num_edges_; }
 
   /// @brief Adiciona uma aresta entre u e v.
   /// @param u Primeiro vértice.
@@ -69,6 +94,51 @@ class Graph {
   /// @brief Adiciona um novo vértice ao grafo.
   void add_vertex(size_t v) noexcept;
 
+  /// @brief Remove um lote de vértices e compacta os ids restantes em uma passada linear.
+  ///
+  /// Os vértices restantes mantêm a ordem relativa e são renumerados de 0 a n-k-1; as listas de
+  /// adjacência são filtradas e renumeradas no lugar, em O(n + m).
+  ///
+  /// @param batch Vértices a remover (repetições são ignoradas).
+  /// @return Novo id de cada vértice antigo, ou REMOVED_VERTEX se ele foi removido.
+  /// @throws std::out_of_range Se algum vértice for inválido (o grafo não é alterado).
+  std::vector<size_t> remove_vertices(std::span<const size_t> batch) {
+    std::vector<size_t> old_to_new(num_vertices_, 0);
+    for (size_t v : batch) {
+      if (v >= num_vertices_) {
+        throw std::out_of_range("Graph::remove_vertices: vértice inválido");
+      }
+      old_to_new[v] = REMOVED_VERTEX;
+    }
+
+    size_t next = 0;
+    for (size_t v = 0; v < num_vertices_; ++v) {
+      if (old_to_new[v] != REMOVED_VERTEX) {
+        old_to_new[v] = next++;
+      }
+    }
+
+    num_edges_ = 0;
+    for (size_t v = 0; v < num_vertices_; ++v) {
+      if (old_to_new[v] == REMOVED_VERTEX) {
+        continue;
+      }
+      std::vector<size_t>& neighbors = adj_list_[v];
+      std::erase_if(neighbors, [&](size_t u) { return old_to_new[u] == REMOVED_VERTEX; });
+      for (size_t& u : neighbors) {
+        u = old_to_new[u];
+      }
+      num_edges_ += neighbors.size();
+      if (old_to_new[v] != v) {
+        adj_list_[old_to_new[v]] = std::move(neighbors);
+      }
+    }
+    num_edges_ /= 2;
+    num_vertices_ = next;
+    adj_list_.resize(next);
+    return old_to_new;
+  }
+
   /// @brief Retorna o grau do vértice.
   /// @param v Vértice.
   /// @return Grau do vértice.
@@ -0,0 +1,119 @@
+#include "common/graph_profile.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "common/distances.hpp"
+#include "common/triangles.hpp"
+
+namespace {
+
+/// Buscas gastas na estimativa do diâmetro (4-sweep, busca do centro e três lotes do iFUB).
+constexpr size_t PROFILE_DIAMETER_TRAVERSALS = 8;
+
+}  // namespace
+
+GraphProfile profile_graph(const Graph& graph) {
+  GraphProfile profile;
+  const size_t n = graph.order();
+  profile.vertices = n;
+  profile.edges = graph.num_edges();
+  profile.density = graph.density();
+  if (n == 0) {
+    return profile;
+  }
+
+  // Passo paralelo: graus, histograma e folhas. Cada thread aumenta o próprio histograma conforme
+  // encontra graus maiores, então o grau máximo sai do mesmo laço.
+  std::vector<size_t> histogram;
+  size_t min_degree = std::numeric_limits<size_t>::max();
+  size_t max_degree = 0;
+  size_t isolated = 0;
+  size_t leaves = 0;
+  size_t degree_squares = 0;
+  const auto count = static_cast<int64_t>(n);
+
+#pragma omp parallel reduction(min : min_degree) reduction(max : max_degree) \
+    reduction(+ : isolated, leaves, degree_squares)
+  {
+    std::vector<size_t> local_histogram;
+
+#pragma omp for schedule(dynamic, 256) nowait
+    for (int64_t i = 0; i < count; ++i) {
+      const auto v = static_cast<size_t>(i);
+      const size_t d = graph.degree(v);
+      if (d >= local_histogram.size()) {
+        local_histogram.resize(d + 1, 0);
+      }
+      ++local_histogram[d];
+      min_degree = std::min(min_degree, d);
+      max_degree = std::max(max_degree, d);
+      isolated += d == 0 ? 1 : 0;
+      leaves += d == 1 ? 1 : 0;
+      degree_squares += d * d;
+    }
+
+#pragma omp critical
+    {
+      if (local_histogram.size() > histogram.size()) {
+        histogram.resize(local_histogram.size(), 0);
+      }
+      for (size_t d = 0; d < local_histogram.size(); ++d) {
+        histogram[d] += local_histogram[d];
+      }
+    }
+  }
+
+  profile.min_degree = min_degree;
+  profile.max_degree = max_degree;
+  profile.degree_histogram = std::move(histogram);
+  profile.isolated = isolated;
+  profile.leaves = leaves;
+  profile.average_degree = 2.0 * static_cast<double>(profile.edges) / static_cast<double>(n);
+  const double mean_square = static_cast<double>(degree_squares) / static_cast<double>(n);
+  profile.degree_stddev = std::sqrt(std::max(0.0, mean_square - profile.average_degree * profile.average_degree));
+
+  const TriangleCounts triangles = count_triangles(graph);
+  profile.triangles = triangles.total;
+  profile.average_clustering = average_clustering(graph, triangles);
+  profile.transitivity = transitivity(graph, triangles);
+
+  // Componentes por busca em largura, guardando um vértice de maior grau da maior componente
+  std::vector<size_t> dist(n, UNREACHABLE);
+  std::vector<size_t> queue;
+  size_t largest_hub = 0;
+  size_t largest_size = 0;
+  for (size_t s = 0; s < n; ++s) {
+    if (dist[s] != UNREACHABLE) {
+      continue;
+    }
+    queue.assign(1, s);
+    dist[s] = 0;
+    size_t hub = s;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      const size_t v = queue[head];
+      hub = graph.degree(v) > graph.degree(hub) ? v : hub;
+      for (size_t u : graph.neighbors_span(v)) {
+        if (dist[u] == UNREACHABLE) {
+          dist[u] = 0;
+          queue.push_back(u);
+        }
+      }
+    }
+    profile.component_sizes.push_back(queue.size());
+    if (queue.size() > largest_size) {
+      largest_size = queue.size();
+      largest_hub = hub;
+    }
+  }
+  profile.num_components = profile.component_sizes.size();
+  std::sort(profile.component_sizes.begin(), profile.component_sizes.end(), std::greater<>());
+
+  const DiameterEstimate diameter = estimate_diameter(graph, largest_hub, PROFILE_DIAMETER_TRAVERSALS);
+  profile.diameter_lower = diameter.lower;
+  profile.diameter_upper = diameter.upper;
+
+  return profile;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Perfil estrutural de uma instância, usado para escolher a configuração dos resolvedores.
+struct GraphProfile {
+  size_t vertices = 0;
+  size_t edges = 0;
+  double density = 0.0;
+
+  size_t min_degree = 0;
+  size_t max_degree = 0;
+  double average_degree = 0.0;
+  double degree_stddev = 0.0;
+  std::vector<size_t> degree_histogram;  ///< degree_histogram[d] = número de vértices de grau d
+
+  size_t isolated = 0;  ///< Vértices de grau 0
+  size_t leaves = 0;    ///< Vértices de grau 1
+
+  size_t num_components = 0;
+  std::vector<size_t> component_sizes;  ///< Tamanhos em ordem decrescente
+
+  size_t triangles = 0;
+  double average_clustering = 0.0;  ///< Média do coeficiente local (vértices de grau < 2 contam 0)
+  double transitivity = 0.0;        ///< 3 * triângulos / caminhos de comprimento 2
+
+  size_t diameter_lower = 0;  ///< Limitantes do diâmetro da maior componente (estimate_diameter())
+  size_t diameter_upper = 0;
+
+  /// @brief Indica se o grafo é uma floresta (m = n - componentes).
+  [[nodiscard]] bool is_forest() const noexcept { return edges + num_components == vertices; }
+
+  /// @brief Tamanho da maior componente (0 no grafo vazio).
+  [[nodiscard]] size_t largest_component() const noexcept {
+    return component_sizes.empty() ? 0 : component_sizes.front();
+  }
+};
+
+/// @brief Calcula o perfil completo do grafo.
+///
+/// Quatro passadas: graus (inclusive o máximo), histograma e folhas saem de um único laço paralelo
+/// (OpenMP) sobre os vértices; triângulos e agrupamento vêm de count_triangles(); componentes usam
+/// uma busca em largura serial e o diâmetro vem de estimate_diameter() com poucas buscas.
+///
+/// @param graph Grafo.
+/// @return Perfil da instância.
+[[nodiscard]] GraphProfile profile_graph(const Graph& graph);
@@ -1,37 +1,699 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ostream>
 #include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "common/random_engines.hpp"
+
+/// @brief Tamanho da linha de cache usado para isolar o estado de cada thread
+inline constexpr size_t RNG_CACHE_LINE_SIZE = 64;
+
+/// @brief Nome do motor gravado nos checkpoints, para recusar estados de outro motor
+template <typename Engine>
+inline constexpr std::string_view RNG_ENGINE_NAME = "desconhecido";
+template <>
+inline constexpr std::string_view RNG_ENGINE_NAME<std::mt19937_64> = "mt19937_64";
+template <>
+inline constexpr std::string_view RNG_ENGINE_NAME<Xoshiro256PlusPlus> = "xoshiro256++";
+template <>
+inline constexpr std::string_view RNG_ENGINE_NAME<Pcg64> = "pcg64";
+template <>
+inline constexpr std::string_view RNG_ENGINE_NAME<SplitMix64> = "splitmix64";
+
+template <typename Engine>
+class BasicRNG;
+
+/**
+ * @brief Motor com jump() e long_jump() (xoshiro256++)
+ *
+ * BasicRNG separa os fluxos das threads por jump(), garantidamente disjuntos.
+ */
+template <typename Engine>
+concept JumpableEngine = requires(Engine engine) {
+  engine.jump();
+  engine.long_jump();
+};
+
+/**
+ * @brief Motor com advance() de 128 bits (PCG64)
+ *
+ * BasicRNG separa os fluxos das threads por advance(), garantidamente
+ * disjuntos.
+ */
+template <typename Engine>
+concept AdvanceableEngine = sizeof(typename Engine::difference_type) == 16 &&
+                            requires(Engine engine, typename Engine::difference_type delta) { engine.advance(delta); };
+
 /**
- * @class RNG
+ * @brief Inteiro uniforme em [0, bound) pelo método de Lemire
+ * @tparam Engine Motor com saída uniforme em [0, 2^64)
+ * @param engine Motor
+ * @param bound Limite exclusivo (deve ser positivo)
+ * @return Valor uniforme em [0, bound)
+ *
+ * Multiplica 64 bits aleatórios por bound (128 bits) e usa a metade alta. A
+ * divisão que calcula o limiar de rejeição só acontece quando a metade baixa
+ * cai abaixo de bound, com probabilidade bound / 2^64 ("Fast random integer
+ * generation in an interval", 2019).
+ */
+template <typename Engine>
+inline uint64_t bounded_u64(Engine& engine, uint64_t bound) {
+  static_assert(Engine::min() == 0 && Engine::max() == UINT64_MAX, "bounded_u64: motor deve gerar 64 bits");
+  auto product = static_cast<unsigned __int128>(engine()) * bound;
+  if (static_cast<uint64_t>(product) < bound) {
+    const uint64_t threshold = -bound % bound;
+    while (static_cast<uint64_t>(product) < threshold) {
+      product = static_cast<unsigned __int128>(engine()) * bound;
+    }
+  }
+  return static_cast<uint64_t>(product >> 64);
+}
+
+/**
+ * @brief Versão de 32 bits de bounded_u64(), só com multiplicação de 64 bits
+ * @tparam Engine Motor com saída uniforme em [0, 2^64)
+ * @param engine Motor
+ * @param bound Limite exclusivo (deve ser positivo)
+ * @return Valor uniforme em [0, bound)
+ *
+ * Usa os 32 bits mais altos de cada número do motor.
+ */
+template <typename Engine>
+inline uint32_t bounded_u32(Engine& engine, uint32_t bound) {
+  static_assert(Engine::min() == 0 && Engine::max() == UINT64_MAX, "bounded_u32: motor deve gerar 64 bits");
+  uint64_t product = (engine() >> 32) * bound;
+  if (static_cast<uint32_t>(product) < bound) {
+    const uint32_t threshold = -bound % bound;
+    while (static_cast<uint32_t>(product) < threshold) {
+      product = (engine() >> 32) * bound;
+    }
+  }
+  return static_cast<uint32_t>(product >> 32);
+}
+
+/**
+ * @class RNGStream
+ * @brief Fluxo de números aleatórios de uma thread: um motor e as
+ * distribuições sobre ele
+ * @tparam Engine Motor de 64 bits construível a partir de uma semente uint64_t
+ *
+ * Cada fluxo ocupa linhas de cache exclusivas. Sem o alinhamento, motores
+ * pequenos (32 bytes no xoshiro256++) de threads vizinhas dividiriam a mesma
+ * linha e cada número gerado invalidaria a linha nas outras threads (falso
+ * compartilhamento).
+ *
+ * Um fluxo não deve ser usado por duas threads ao mesmo tempo; obtenha-o com
+ * BasicRNG::local() ou BasicRNG::stream().
+ */
+template <typename Engine>
+class alignas(RNG_CACHE_LINE_SIZE) RNGStream {
+ private:
+  /// Números brutos gerados por vez nos métodos fill_*
+  static constexpr size_t FILL_CHUNK = 256;
+
+  /// Limite de tamanho do estado textual aceito por load()
+  static constexpr uint64_t MAX_STATE_SIZE = uint64_t{1} << 20;
+
+  Engine engine_;  ///< Motor do fluxo
+
+  friend class BasicRNG<Engine>;
+
+  /// Grava um inteiro de 64 bits em little-endian
+  static void write_u64(std::ostream& os, uint64_t value) {
+    char bytes[8];
+    for (int i = 0; i < 8; ++i) {
+      bytes[i] = static_cast<char>(value >> (8 * i));
+    }
+    os.write(bytes, 8);
+  }
+
+  /// Lê um inteiro de 64 bits em little-endian
+  static uint64_t read_u64(std::istream& is) {
+    unsigned char bytes[8];
+    if (!is.read(reinterpret_cast<char*>(bytes), 8)) {
+      throw std::runtime_error("RNG: checkpoint truncado");
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+      value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  /// Real uniforme no intervalo aberto (0, 1), seguro para log()
+  double open_unit() { return (static_cast<double>(engine_() >> 11) + 0.5) * 0x1.0p-53; }
+
+ public:
+  using engine_type = Engine;  ///< Motor do fluxo
+
+  /**
+   * @brief Constrói o fluxo
+   * @param seed Semente do motor
+   */
+  explicit RNGStream(uint64_t seed) : engine_(seed) {}
+
+  /**
+   * @brief Constrói o fluxo a partir de um motor já posicionado
+   * @param engine Motor copiado
+   */
+  explicit RNGStream(const Engine& engine) : engine_(engine) {}
+
+  /**
+   * @brief Re-inicializa o motor
+   * @param seed Nova semente
+   */
+  void seed(uint64_t seed) { engine_.seed(seed); }
+
+  /**
+   * @brief Acesso direto ao motor, para distribuições da biblioteca padrão
+   * @return Motor do fluxo
+   */
+  Engine& engine() noexcept { return engine_; }
+
+  /**
+   * @brief Grava o estado completo do motor
+   * @param os Destino, aberto em modo binário
+   *
+   * Formato: tamanho (64 bits, little-endian) seguido do estado textual do
+   * motor (operador <<), portável entre bibliotecas padrão.
+   */
+  void save(std::ostream& os) const {
+    std::ostringstream text;
+    text << engine_;
+    const std::string state = text.str();
+    write_u64(os, state.size());
+    os.write(state.data(), static_cast<std::streamsize>(state.size()));
+  }
+
+  /**
+   * @brief Restaura o estado gravado por save()
+   * @param is Origem, aberta em modo binário
+   * @throws std::runtime_error Se o estado estiver truncado ou inválido; o
+   * fluxo não é alterado nesse caso.
+   */
+  void load(std::istream& is) {
+    const uint64_t size = read_u64(is);
+    if (size > MAX_STATE_SIZE) {
+      throw std::runtime_error("RNGStream::load: estado inválido");
+    }
+    std::string state(size, '\0');
+    if (!is.read(state.data(), static_cast<std::streamsize>(size))) {
+      throw std::runtime_error("RNG: checkpoint truncado");
+    }
+    std::istringstream text(state);
+    Engine engine;
+    if (!(text >> engine)) {
+      throw std::runtime_error("RNGStream::load: estado inválido");
+    }
+    engine_ = engine;
+  }
+
+  /**
+   * @brief Gera 64 bits aleatórios uniformes
+   * @return Valor uniforme em [0, 2^64)
+   *
+   * Útil para derivar sementes de fluxos independentes (por exemplo, um por
+   * bloco de trabalho em geradores de grafos).
+   */
+  uint64_t next_u64() { return engine_(); }
+
+  /**
+   * @brief Gera um número inteiro uniforme no intervalo fechado [min, max]
+   * @param min Valor mínimo (inclusive)
+   * @param max Valor máximo (inclusive)
+   * @return Número inteiro aleatório em [min, max]
+   *
+   * Usa bounded_u32() sobre a amplitude do intervalo, sem construir uma
+   * distribuição a cada chamada.
+   *
+   * @warning min deve ser menor ou igual a max, sem validação
+   */
+  int uniform_int(int min, int max) {
+    const auto range = static_cast<uint32_t>(static_cast<int64_t>(max) - min + 1);
+    const uint32_t offset = range == 0 ? static_cast<uint32_t>(engine_() >> 32) : bounded_u32(engine_, range);
+    return static_cast<int>(static_cast<int64_t>(min) + offset);
+  }
+
+  /**
+   * @brief Gera um inteiro uniforme em [0, bound) com 64 bits
+   * @param bound Limite exclusivo
+   * @return Valor uniforme em [0, bound)
+   *
+   * Caminho rápido para sortear índices (por exemplo, um vértice aleatório
+   * em uma busca local): em geral uma multiplicação, sem divisões.
+   *
+   * @warning bound deve ser positivo, sem validação
+   */
+  uint64_t uniform_below(uint64_t bound) { return bounded_u64(engine_, bound); }
+
+  /**
+   * @brief Gera um inteiro uniforme em [0, bound) com 32 bits
+   * @param bound Limite exclusivo
+   * @return Valor uniforme em [0, bound)
+   *
+   * Como uniform_below(), mas com multiplicação de 64 bits; preferível
+   * quando bound cabe em 32 bits.
+   *
+   * @warning bound deve ser positivo, sem validação
+   */
+  uint32_t uniform_below32(uint32_t bound) {
+    return bounded_u32(engine_, bound);
+  }
+
+  /**
+   * @brief Gera um número real uniforme no intervalo semi-aberto [min, max)
+   * @param min Valor mínimo (inclusive, padrão 0.0)
+   * @param max Valor máximo (exclusive, padrão 1.0)
+   * @return Número real aleatório em [min, max)
+   */
+  double uniform_real(double min = 0.0, double max = 1.0) {
+    std::uniform_real_distribution<double> dist(min, max);
+    return dist(engine_);
+  }
+
+  /**
+   * @brief Gera um valor de distribuição normal (Gaussiana)
+   * @param mean Média da distribuição (padrão 0.0)
+   * @param stddev Desvio padrão (padrão 1.0)
+   * @return Valor aleatório da distribuição N(mean, stddev²)
+   */
+  double normal(double mean = 0.0, double stddev = 1.0) {
+    std::normal_distribution<double> dist(mean, stddev);
+    return dist(engine_);
+  }
+
+  /**
+   * @brief Gera um valor booleano com a probabilidade dada
+   * @param p Probabilidade de retornar verdadeiro (padrão 0.5)
+   * @return true com probabilidade p, false com probabilidade (1-p)
+   *
+   * @warning p deve estar no intervalo [0.0, 1.0], sem validação
+   */
+  bool bernoulli(double p = 0.5) {
+    std::bernoulli_distribution dist(p);
+    return dist(engine_);
+  }
+
+  /**
+   * @brief Preenche um buffer com reais uniformes em [min, max)
+   * @param out Destino
+   * @param min Valor mínimo (inclusive, padrão 0.0)
+   * @param max Valor máximo (exclusive, padrão 1.0)
+   *
+   * Gera os números brutos em blocos de FILL_CHUNK e converte cada bloco em
+   * um laço sem dependências, vetorizado pelo compilador (AVX2/AVX-512 com
+   * -march=native). Cada valor usa os 53 bits mais altos de um número do
+   * motor, então a sequência difere de chamadas repetidas a uniform_real().
+   * Útil para chaves aleatórias (BRKGA) e perturbações em massa.
+   */
+  void fill_uniform_real(std::span<double> out, double min = 0.0, double max = 1.0) {
+    const double scale = (max - min) * 0x1.0p-53;
+    uint64_t bits[FILL_CHUNK];
+
+    for (size_t begin = 0; begin < out.size(); begin += FILL_CHUNK) {
+      const size_t count = std::min(FILL_CHUNK, out.size() - begin);
+      for (size_t i = 0; i < count; ++i) {
+        bits[i] = engine_();
+      }
+      double* chunk = out.data() + begin;
+      for (size_t i = 0; i < count; ++i) {
+        chunk[i] = min + static_cast<double>(bits[i] >> 11) * scale;
+      }
+    }
+  }
+
+  /**
+   * @brief Preenche um buffer com inteiros uniformes em [min, max]
+   * @param out Destino
+   * @param min Valor mínimo (inclusive)
+   * @param max Valor máximo (inclusive)
+   *
+   * Mesmo método de bounded_u32(), mas com o limiar de rejeição calculado
+   * uma única vez por chamada, então cada valor custa um número do motor e
+   * uma multiplicação.
+   *
+   * @warning min deve ser menor ou igual a max, sem validação
+   */
+  void fill_uniform_int(std::span<int> out, int min, int max) {
+    const auto range = static_cast<uint32_t>(static_cast<int64_t>(max) - min + 1);
+    const uint32_t threshold = range == 0 ? 0 : -range % range;
+    const uint64_t factor = range == 0 ? uint64_t{1} << 32 : range;
+
+    for (int& value : out) {
+      uint64_t product = (engine_() >> 32) * factor;
+      while (static_cast<uint32_t>(product) < threshold) [[unlikely]] {
+        product = (engine_() >> 32) * factor;
+      }
+      value = static_cast<int>(min + static_cast<int64_t>(product >> 32));
+    }
+  }
+
+  /**
+   * @brief Preenche um buffer com valores de Bernoulli (1 com probabilidade p)
+   * @param out Destino (0 ou 1 em cada posição)
+   * @param p Probabilidade de 1 (padrão 0.5)
+   *
+   * Compara os 53 bits mais altos de cada número com p * 2^53 em um laço
+   * vetorizado; p <= 0 gera só zeros e p >= 1 só uns.
+   */
+  void fill_bernoulli(std::span<uint8_t> out, double p = 0.5) {
+    const auto limit = static_cast<uint64_t>(std::clamp(p, 0.0, 1.0) * 0x1.0p53);
+    uint64_t bits[FILL_CHUNK];
+
+    for (size_t begin = 0; begin < out.size(); begin += FILL_CHUNK) {
+      const size_t count = std::min(FILL_CHUNK, out.size() - begin);
+      for (size_t i = 0; i < count; ++i) {
+        bits[i] = engine_();
+      }
+      uint8_t* chunk = out.data() + begin;
+      for (size_t i = 0; i < count; ++i) {
+        chunk[i] = static_cast<uint8_t>((bits[i] >> 11) < limit);
+      }
+    }
+  }
+
+  /**
+   * @brief Embaralha aleatoriamente os elementos de um vetor
+   * @tparam T Tipo do elemento do vetor
+   * @param vec Vetor a ser embaralhado (modificado no local)
+   *
+   * Útil para gerar permutações aleatórias em problemas como TSP,
+   * problemas de alocação e outras tarefas de otimização combinatória.
+   */
+  template <typename T>
+  void shuffle(std::vector<T>& vec) {
+    std::shuffle(vec.begin(), vec.end(), engine_);
+  }
+
+  /**
+   * @brief Embaralha só o início de um vetor (Fisher–Yates parcial)
+   * @tparam T Tipo do elemento do vetor
+   * @param vec Vetor (modificado no local)
+   * @param k Número de posições sorteadas (k > vec.size() equivale a
+   * vec.size())
+   *
+   * Os k primeiros elementos passam a ser uma amostra uniforme sem reposição,
+   * em ordem aleatória, em O(k); o restante fica com os não sorteados.
+   */
+  template <typename T>
+  void partial_shuffle(std::vector<T>& vec, size_t k) {
+    k = std::min(k, vec.size());
+    for (size_t i = 0; i < k; ++i) {
+      std::swap(vec[i], vec[i + bounded_u64(engine_, vec.size() - i)]);
+    }
+  }
+
+  /**
+   * @brief Sorteia k valores distintos de [0, n) pelo algoritmo de Floyd
+   * @param n Tamanho do universo
+   * @param k Tamanho da amostra (k > n equivale a n)
+   * @param out Destino (redimensionado para k)
+   *
+   * O(k) esperado, com uma tabela de espalhamento de O(k) posições alocada a
+   * cada chamada. Todos os subconjuntos são equiprováveis, mas a ordem em out
+   * não é uniforme (embaralhe se importar). Para chamadas repetidas com o
+   * mesmo n, prefira a versão com scratch.
+   */
+  void sample_k(size_t n, size_t k, std::vector<size_t>& out) {
+    k = std::min(k, n);
+    out.clear();
+    out.reserve(k);
+    if (k == 0) {
+      return;
+    }
+
+    // Endereçamento aberto com value + 1 (0 marca posição livre)
+    const size_t capacity = std::bit_ceil(2 * k);
+    const int shift = 64 - std::countr_zero(capacity);
+    std::vector<size_t> table(capacity, 0);
+    auto insert = [&](size_t value) {
+      size_t slot = static_cast<size_t>((value * 0x9e3779b97f4a7c15ULL) >> shift);
+      while (table[slot] != 0) {
+        if (table[slot] == value + 1) {
+          return false;
+        }
+        slot = (slot + 1) & (capacity - 1);
+      }
+      table[slot] = value + 1;
+      return true;
+    };
+
+    for (size_t j = n - k; j < n; ++j) {
+      size_t t = bounded_u64(engine_, j + 1);
+      if (!insert(t)) {
+        t = j;
+        insert(j);
+      }
+      out.push_back(t);
+    }
+  }
+
+  /**
+   * @brief Sorteia k valores distintos de [0, n) em O(k) sem alocação
+   * @param n Tamanho do universo
+   * @param k Tamanho da amostra (k > n equivale a n)
+   * @param out Destino (redimensionado para k), em ordem aleatória
+   * @param scratch Permutação reutilizável entre chamadas
+   *
+   * Fisher–Yates parcial sobre scratch, que guarda a identidade 0..n-1
+   * (criada em O(n) na primeira chamada ou quando n muda); as k trocas são
+   * desfeitas ao final, então cada chamada seguinte custa O(k). Indicado para
+   * montar listas de candidatos a cada iteração de uma busca local.
+   */
+  void sample_k(size_t n, size_t k, std::vector<size_t>& out, std::vector<size_t>& scratch) {
+    if (scratch.size() != n) {
+      scratch.resize(n);
+      std::iota(scratch.begin(), scratch.end(), size_t{0});
+    }
+    k = std::min(k, n);
+    out.resize(k);
+
+    // out guarda primeiro as posições trocadas e depois os valores sorteados
+    for (size_t i = 0; i < k; ++i) {
+      out[i] = i + bounded_u64(engine_, n - i);
+      std::swap(scratch[i], scratch[out[i]]);
+    }
+    for (size_t i = k; i-- > 0;) {
+      const size_t position = out[i];
+      out[i] = scratch[i];
+      std::swap(scratch[i], scratch[position]);
+    }
+  }
+
+  /**
+   * @brief Amostragem por reservatório de uma sequência de tamanho
+   * desconhecido (algoritmo L de Li)
+   * @tparam InputIt Iterador de entrada
+   * @param first Início da sequência
+   * @param last Fim da sequência
+   * @param out Reservatório com a capacidade desejada k
+   * @return Número de posições preenchidas (min(k, tamanho da sequência))
+   *
+   * Percorre a sequência uma vez e usa O(k (1 + log(N / k))) números
+   * aleatórios, pulando trechos com saltos geométricos em vez de sortear um
+   * número por elemento. A ordem no reservatório não é uniforme.
+   */
+  template <std::input_iterator InputIt>
+  size_t reservoir_sample(InputIt first, InputIt last, std::span<std::iter_value_t<InputIt>> out) {
+    const size_t k = out.size();
+    size_t count = 0;
+    for (; first != last && count < k; ++first) {
+      out[count++] = *first;
+    }
+    if (count < k || k == 0) {
+      return count;
+    }
+
+    const double inverse_k = 1.0 / static_cast<double>(k);
+    double w = std::exp(std::log(open_unit()) * inverse_k);
+    for (;;) {
+      const double skip = std::floor(std::log(open_unit()) / std::log1p(-w));
+      for (double s = 0; s < skip && first != last; ++s) {
+        ++first;
+      }
+      if (first == last) {
+        return k;
+      }
+      out[bounded_u64(engine_, k)] = *first;
+      ++first;
+      w *= std::exp(std::log(open_unit()) * inverse_k);
+    }
+  }
+
+  /**
+   * @brief Gera um subconjunto aleatório de [0, n) como vetor de bits
+   * @param bits Destino (redimensionado para ceil(n / 64) palavras; o bit i
+   * fica em bits[i / 64], posição i % 64; bits acima de n ficam zerados)
+   * @param n Tamanho do universo
+   * @param p Probabilidade de cada elemento pertencer (padrão 0.5)
+   *
+   * Com p = 0.5 cada palavra é um número do motor. Nos demais casos, os
+   * elementos sorteados (ou, se p > 0.5, os excluídos) são alcançados por
+   * saltos geométricos, em O(1 + n * min(p, 1 - p)) números aleatórios.
+   */
+  void random_subset(std::vector<uint64_t>& bits, size_t n, double p = 0.5) {
+    const size_t words = (n + 63) / 64;
+    if (p == 0.5) {
+      bits.resize(words);
+      for (uint64_t& word : bits) {
+        word = engine_();
+      }
+    } else if (p <= 0.0 || p >= 1.0) {
+      bits.assign(words, p >= 1.0 ? ~uint64_t{0} : 0);
+    } else {
+      const bool complement = p > 0.5;
+      const double log_q = std::log1p(-(complement ? 1.0 - p : p));
+      bits.assign(words, complement ? ~uint64_t{0} : 0);
+      double position = std::floor(std::log(open_unit()) / log_q);
+      while (position < static_cast<double>(n)) {
+        const auto i = static_cast<size_t>(position);
+        bits[i / 64] ^= uint64_t{1} << (i % 64);
+        position += 1.0 + std::floor(std::log(open_unit()) / log_q);
+      }
+    }
+    if (n % 64 != 0) {
+      bits.back() &= (uint64_t{1} << (n % 64)) - 1;
+    }
+  }
+};
+
+/**
+ * @class BasicRNG
  * @brief Gerador de números aleatórios seguro para threads com estado por
  * thread
+ * @tparam Engine Motor de 64 bits construível a partir de uma semente
+ * uint64_t (std::mt19937_64, Xoshiro256PlusPlus, Pcg64, SplitMix64, ...)
  *
- * Esta classe mantém um gerador Mersenne Twister separado para cada thread,
+ * Esta classe mantém um fluxo (RNGStream) separado para cada thread,
  * eliminando a sobrecarga de sincronização e garantindo resultados
- * reprodutíveis ao usar a mesma semente mestre.
+ * reprodutíveis ao usar a mesma semente mestre. A semente de cada thread é
+ * derivada da semente mestre da mesma forma para qualquer motor.
+ *
+ * O fluxo pode ser escolhido explicitamente por thread_id em cada chamada ou
+ * obtido uma vez com local(), que associa a thread chamadora a um fluxo
+ * próprio (registrado com bind() ou atribuído no primeiro uso).
  */
-class RNG {
+template <typename Engine>
+class BasicRNG {
+ public:
+  using engine_type = Engine;        ///< Motor de cada thread
+  using Stream = RNGStream<Engine>;  ///< Fluxo de cada thread
+
  private:
-  std::vector<std::mt19937_64> generators_;  ///< Geradores por thread
-  uint64_t master_seed_;                     ///< Semente mestre para reprodutibilidade
-  int num_threads_;                          ///< Número de threads configuradas
+  /// Associação da thread atual a um fluxo de um objeto BasicRNG
+  struct Binding {
+    uint64_t instance;
+    int stream;
+  };
+
+  /// Última associação usada por local() na thread atual
+  struct LocalCache {
+    uint64_t instance = NO_INSTANCE;
+    Stream* stream = nullptr;
+  };
+
+  static constexpr uint64_t NO_INSTANCE = ~uint64_t{0};
+
+  std::vector<Stream> generators_;                 ///< Geradores por thread
+  uint64_t master_seed_;                           ///< Semente mestre para reprodutibilidade
+  int num_threads_;                                ///< Número de threads configuradas
+  uint64_t instance_ = next_instance();            ///< Identifica o objeto nas associações das threads
+  std::unique_ptr<std::atomic<bool>[]> claimed_;  ///< claimed_[i]: fluxo i associado a alguma thread
+
+  static uint64_t next_instance() {
+    static std::atomic<uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static std::unique_ptr<std::atomic<bool>[]> make_claims(int threads) {
+    return std::make_unique<std::atomic<bool>[]>(static_cast<size_t>(std::max(threads, 0)));
+  }
+
+  /// Associações da thread atual, a mais recente primeiro
+  static std::vector<Binding>& bindings() {
+    thread_local std::vector<Binding> list;
+    return list;
+  }
+
+  /// Atalho de local(): uma comparação quando a thread repete o objeto
+  static LocalCache& local_cache() {
+    thread_local LocalCache cache;
+    return cache;
+  }
+
+  /// Tenta reservar o fluxo id para a thread atual
+  bool claim(int id) noexcept {
+    return !claimed_[id].load(std::memory_order_relaxed) && !claimed_[id].exchange(true, std::memory_order_acq_rel);
+  }
+
+  /// Libera todos os fluxos (objeto novo para as associações das threads)
+  void release_all_claims() noexcept {
+    for (int i = 0; i < num_threads_; ++i) {
+      claimed_[i].store(false, std::memory_order_relaxed);
+    }
+  }
+
+  /// Registra a associação da thread atual ao fluxo id, já reservado
+  Stream& remember(int id) {
+    bindings().insert(bindings().begin(), Binding{instance_, id});
+    local_cache() = {instance_, &generators_[id]};
+    return generators_[id];
+  }
+
+  /// Identificador de formato dos checkpoints ("RNGCKPT1" em little-endian)
+  static constexpr uint64_t CHECKPOINT_MAGIC = 0x3154504b43474e52ULL;
+
+  /// Distância entre os fluxos das threads e entre subfluxos com advance()
+  static constexpr unsigned __int128 ADVANCE_THREAD_STRIDE = static_cast<unsigned __int128>(1) << 64;
+  static constexpr unsigned __int128 ADVANCE_SUBSTREAM_STRIDE = static_cast<unsigned __int128>(1) << 96;
 
   /**
    * @brief Inicializa os geradores para todas as threads
    *
-   * Usa a semente mestre para gerar de forma determinística sementes únicas
-   * para o gerador de cada thread, garantindo reprodutibilidade.
+   * Usa a semente mestre para gerar de forma determinística o gerador de cada
+   * thread, garantindo reprodutibilidade. Motores com salto partem de um
+   * único motor semeado com a semente mestre: a thread i começa i * 2^128
+   * passos adiante (jump()) ou i * 2^64 passos adiante (advance() do PCG64),
+   * então os fluxos são disjuntos. Os demais recebem sementes sorteadas por
+   * um std::mt19937_64, sem essa garantia.
    */
   void init_generators() {
     generators_.reserve(num_threads_);
-    std::mt19937_64 seed_gen(master_seed_);
 
-    for (int i = 0; i < num_threads_; ++i) {
-      generators_.emplace_back(seed_gen());
+    if constexpr (JumpableEngine<Engine>) {
+      Engine engine(master_seed_);
+      for (int i = 0; i < num_threads_; ++i) {
+        generators_.emplace_back(engine);
+        engine.jump();
+      }
+    } else if constexpr (AdvanceableEngine<Engine>) {
+      Engine engine(master_seed_);
+      for (int i = 0; i < num_threads_; ++i) {
+        generators_.emplace_back(engine);
+        engine.advance(ADVANCE_THREAD_STRIDE);
+      }
+    } else {
+      std::mt19937_64 seed_gen(master_seed_);
+      for (int i = 0; i < num_threads_; ++i) {
+        generators_.emplace_back(seed_gen());
+      }
     }
   }
 
@@ -43,7 +705,10 @@ class RNG {
    * Usa std::random_device para gerar uma semente não determinística.
    * Não é adequado para experimentos reprodutíveis.
    */
-  explicit RNG(int threads) : master_seed_(std::random_device{}()), num_threads_(threads) { init_generators(); }
+  explicit BasicRNG(int threads)
+      : master_seed_(std::random_device{}()), num_threads_(threads), claimed_(make_claims(threads)) {
+    init_generators();
+  }
 
   /**
    * @brief Constrói o RNG com semente fixa
@@ -53,99 +718,355 @@ class RNG {
    * Usar a mesma semente produzirá sequências idênticas em execuções,
    * essencial para experimentos reprodutíveis em meta-heurísticas.
    */
-  RNG(int threads, uint64_t seed) : master_seed_(seed), num_threads_(threads) { init_generators(); }
+  BasicRNG(int threads, uint64_t seed) : master_seed_(seed), num_threads_(threads), claimed_(make_claims(threads)) {
+    init_generators();
+  }
+
+  /**
+   * @brief Copia o estado de todos os fluxos
+   *
+   * Para local() e bind(), a cópia é um objeto novo: nenhuma thread começa
+   * associada a ela e todos os fluxos estão livres. Assim as associações do
+   * original não passam para a cópia, e duas threads nunca recebem o mesmo
+   * fluxo da cópia.
+   */
+  BasicRNG(const BasicRNG& other)
+      : generators_(other.generators_),
+        master_seed_(other.master_seed_),
+        num_threads_(other.num_threads_),
+        claimed_(make_claims(other.num_threads_)) {}
+
+  /**
+   * @brief Move o estado de todos os fluxos
+   *
+   * As associações das threads não acompanham, como na cópia. O objeto de
+   * origem fica sem fluxos.
+   */
+  BasicRNG(BasicRNG&& other) noexcept
+      : generators_(std::move(other.generators_)),
+        master_seed_(other.master_seed_),
+        num_threads_(std::exchange(other.num_threads_, 0)),
+        claimed_(std::move(other.claimed_)) {
+    other.instance_ = next_instance();
+    release_all_claims();
+  }
+
+  /// @brief Copia o estado de todos os fluxos e descarta as associações das threads, como na cópia
+  BasicRNG& operator=(const BasicRNG& other) {
+    if (this != &other) {
+      generators_ = other.generators_;
+      master_seed_ = other.master_seed_;
+      num_threads_ = other.num_threads_;
+      claimed_ = make_claims(num_threads_);
+      instance_ = next_instance();
+    }
+    return *this;
+  }
+
+  /// @brief Move o estado de todos os fluxos e descarta as associações das threads, como na cópia
+  BasicRNG& operator=(BasicRNG&& other) noexcept {
+    if (this != &other) {
+      generators_ = std::move(other.generators_);
+      master_seed_ = other.master_seed_;
+      num_threads_ = std::exchange(other.num_threads_, 0);
+      claimed_ = std::move(other.claimed_);
+      instance_ = next_instance();
+      other.instance_ = next_instance();
+      release_all_claims();
+    }
+    return *this;
+  }
+
+  ~BasicRNG() = default;
 
   /**
    * @brief Re-inicializa todos os geradores com uma nova semente
    * @param seed Nova semente mestre
    *
    * Útil para rodar múltiplos experimentos independentes com
-   * sequências aleatórias diferentes sem recriar o objeto RNG.
+   * sequências aleatórias diferentes sem recriar o objeto RNG. Os fluxos são
+   * re-semeados no lugar: associações e referências obtidas com local() e
+   * stream() continuam válidas.
    */
   void reseed(uint64_t seed) {
     master_seed_ = seed;
-    std::mt19937_64 seed_gen(seed);
+    std::vector<Stream> current;
+    current.swap(generators_);
+    init_generators();
+    std::copy(generators_.begin(), generators_.end(), current.begin());
+    generators_.swap(current);
+  }
 
-    for (int i = 0; i < num_threads_; ++i) {
-      generators_[i].seed(seed_gen());
+  /**
+   * @brief Cria subfluxos disjuntos entre si e dos fluxos das threads
+   * @param count Número de subfluxos
+   * @return Subfluxos 0 a count-1
+   *
+   * O subfluxo k começa (k + 1) * 2^192 passos adiante do motor base
+   * (long_jump()) no xoshiro256++, ou (k + 1) * 2^96 passos adiante
+   * (advance()) no PCG64, enquanto as threads ocupam o início do primeiro
+   * bloco. Útil para modelos de ilhas e milhares de reinícios: cada ilha ou
+   * reinício recebe o seu subfluxo, que pode ser movido para outra thread.
+   * Custo O(count).
+   */
+  [[nodiscard]] std::vector<Stream> substreams(size_t count) const
+    requires JumpableEngine<Engine> || AdvanceableEngine<Engine>
+  {
+    std::vector<Stream> result;
+    result.reserve(count);
+    Engine engine(master_seed_);
+    for (size_t k = 0; k < count; ++k) {
+      if constexpr (JumpableEngine<Engine>) {
+        engine.long_jump();
+      } else {
+        engine.advance(ADVANCE_SUBSTREAM_STRIDE);
+      }
+      result.emplace_back(engine);
     }
+    return result;
   }
 
   /**
-   * @brief Gera um número inteiro uniforme no intervalo fechado [min, max]
-   * @param thread_id ID da thread chamadora (0 a num_threads-1)
-   * @param min Valor mínimo (inclusive)
-   * @param max Valor máximo (inclusive)
-   * @return Número inteiro aleatório em [min, max]
+   * @brief Fluxo de uma thread, com verificação de limites
+   * @param thread_id ID do fluxo (0 a num_threads-1)
+   * @return Fluxo thread_id
+   * @throws std::out_of_range Se thread_id for inválido.
+   */
+  Stream& stream(int thread_id) {
+    if (thread_id < 0 || thread_id >= num_threads_) {
+      throw std::out_of_range("BasicRNG::stream: thread_id fora do intervalo");
+    }
+    return generators_[thread_id];
+  }
+
+  /**
+   * @brief Associa a thread chamadora ao fluxo worker_id
+   * @param worker_id ID do fluxo (0 a num_threads-1)
+   * @throws std::out_of_range Se worker_id for inválido.
+   * @throws std::logic_error Se o fluxo já estiver associado a outra thread
+   * (por exemplo, dois trabalhadores com o mesmo ID ou regiões OpenMP
+   * aninhadas usando omp_get_thread_num()). A associação anterior da thread
+   * é mantida nesse caso.
    *
-   * @warning thread_id deve estar dentro do intervalo válido, sem verificação
-   * de limites
+   * Registro determinístico: chamado no início de cada trabalhador (por
+   * exemplo, com omp_get_thread_num() ou o índice do trabalhador em um pool
+   * de std::thread), garante que cada um use sempre o mesmo fluxo. Chamar de
+   * novo troca a associação e libera o fluxo anterior.
    */
-  int uniform_int(int thread_id, int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(generators_[thread_id]);
+  void bind(int worker_id) {
+    if (worker_id < 0 || worker_id >= num_threads_) {
+      throw std::out_of_range("BasicRNG::bind: worker_id fora do intervalo");
+    }
+    auto& list = bindings();
+    const auto current = std::find_if(list.begin(), list.end(),
+                                      [&](const Binding& binding) { return binding.instance == instance_; });
+    if (current != list.end() && current->stream == worker_id) {
+      local_cache() = {instance_, &generators_[worker_id]};
+      return;
+    }
+    if (!claim(worker_id)) {
+      throw std::logic_error("BasicRNG::bind: fluxo já associado a outra thread");
+    }
+    if (current != list.end()) {
+      claimed_[current->stream].store(false, std::memory_order_release);
+      list.erase(current);
+    }
+    remember(worker_id);
   }
 
   /**
-   * @brief Gera um número real uniforme no intervalo semi-aberto [min, max)
-   * @param thread_id ID da thread chamadora (0 a num_threads-1)
-   * @param min Valor mínimo (inclusive, padrão 0.0)
-   * @param max Valor máximo (exclusive, padrão 1.0)
-   * @return Número real aleatório em [min, max)
+   * @brief Desfaz a associação da thread chamadora, liberando o fluxo
    *
-   * @warning thread_id deve estar dentro do intervalo válido, sem verificação
-   * de limites
+   * Chamado ao fim de um trabalhador que não volta a usar o RNG, para que o
+   * fluxo possa ser associado a outra thread. Sem efeito se a thread não
+   * estiver associada.
    */
-  double uniform_real(int thread_id, double min = 0.0, double max = 1.0) {
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(generators_[thread_id]);
+  void unbind() noexcept {
+    auto& list = bindings();
+    const auto current = std::find_if(list.begin(), list.end(),
+                                      [&](const Binding& binding) { return binding.instance == instance_; });
+    if (current != list.end()) {
+      claimed_[current->stream].store(false, std::memory_order_release);
+      list.erase(current);
+    }
+    if (local_cache().instance == instance_) {
+      local_cache() = {};
+    }
   }
 
   /**
-   * @brief Gera um valor de distribuição normal (Gaussiana)
-   * @param thread_id ID da thread chamadora (0 a num_threads-1)
-   * @param mean Média da distribuição (padrão 0.0)
-   * @param stddev Desvio padrão (padrão 1.0)
-   * @return Valor aleatório da distribuição N(mean, stddev²)
+   * @brief Fluxo da thread chamadora, sem passar thread_id
+   * @return Fluxo associado à thread
+   * @throws std::length_error Se a thread não estiver associada e todos os
+   * fluxos já estiverem associados a outras threads.
    *
-   * @warning thread_id deve estar dentro do intervalo válido, sem verificação
-   * de limites
+   * Uma thread registrada com bind() recebe o seu fluxo. Uma thread não
+   * registrada recebe, no primeiro uso, o menor fluxo ainda livre (a ordem
+   * de chegada não é determinística entre execuções); os fluxos registrados
+   * com bind() nunca são atribuídos a outra thread, e threads além de
+   * num_threads geram erro em vez de compartilhar um gerador. Quando a
+   * thread repete o último objeto usado, local() custa uma comparação.
+   *
+   * @note Cada fluxo fica associado até unbind() ou até a destruição do
+   * objeto, mesmo que a thread termine. As associações ficam na lista
+   * thread_local da thread até ela terminar, mesmo depois de o objeto ser
+   * destruído. Os identificadores nunca são reaproveitados, então entradas
+   * antigas não afetam outros objetos, mas threads de longa duração que
+   * alternam entre muitos RNGs acumulam entradas e as percorrem linearmente.
    */
+  Stream& local() {
+    LocalCache& cache = local_cache();
+    if (cache.instance == instance_) [[likely]] {
+      return *cache.stream;
+    }
+
+    for (const Binding& binding : bindings()) {
+      if (binding.instance == instance_) {
+        cache = {instance_, &generators_[binding.stream]};
+        return *cache.stream;
+      }
+    }
+
+    for (int id = 0; id < num_threads_; ++id) {
+      if (claim(id)) {
+        return remember(id);
+      }
+    }
+    throw std::length_error("BasicRNG::local: mais threads do que fluxos");
+  }
+
+  /// @brief RNGStream::next_u64() no fluxo da thread thread_id (sem verificação de limites)
+  uint64_t next_u64(int thread_id) { return generators_[thread_id].next_u64(); }
+
+  /// @brief RNGStream::uniform_int() no fluxo da thread thread_id (sem verificação de limites)
+  int uniform_int(int thread_id, int min, int max) { return generators_[thread_id].uniform_int(min, max); }
+
+  /// @brief RNGStream::uniform_below() no fluxo da thread thread_id (sem verificação de limites)
+  uint64_t uniform_below(int thread_id, uint64_t bound) { return generators_[thread_id].uniform_below(bound); }
+
+  /// @brief RNGStream::uniform_below32() no fluxo da thread thread_id (sem verificação de limites)
+  uint32_t uniform_below32(int thread_id, uint32_t bound) {
+    return generators_[thread_id].uniform_below32(bound);
+  }
+
+  /// @brief RNGStream::uniform_real() no fluxo da thread thread_id (sem verificação de limites)
+  double uniform_real(int thread_id, double min = 0.0, double max = 1.0) {
+    return generators_[thread_id].uniform_real(min, max);
+  }
+
+  /// @brief RNGStream::normal() no fluxo da thread thread_id (sem verificação de limites)
   double normal(int thread_id, double mean = 0.0, double stddev = 1.0) {
-    std::normal_distribution<double> dist(mean, stddev);
-    return dist(generators_[thread_id]);
+    return generators_[thread_id].normal(mean, stddev);
+  }
+
+  /// @brief RNGStream::bernoulli() no fluxo da thread thread_id (sem verificação de limites)
+  bool bernoulli(int thread_id, double p = 0.5) { return generators_[thread_id].bernoulli(p); }
+
+  /// @brief RNGStream::fill_uniform_real() no fluxo da thread thread_id (sem verificação de limites)
+  void fill_uniform_real(int thread_id, std::span<double> out, double min = 0.0, double max = 1.0) {
+    generators_[thread_id].fill_uniform_real(out, min, max);
+  }
+
+  /// @brief RNGStream::fill_uniform_int() no fluxo da thread thread_id (sem verificação de limites)
+  void fill_uniform_int(int thread_id, std::span<int> out, int min, int max) {
+    generators_[thread_id].fill_uniform_int(out, min, max);
+  }
+
+  /// @brief RNGStream::fill_bernoulli() no fluxo da thread thread_id (sem verificação de limites)
+  void fill_bernoulli(int thread_id, std::span<uint8_t> out, double p = 0.5) {
+    generators_[thread_id].fill_bernoulli(out, p);
+  }
+
+  /// @brief RNGStream::shuffle() no fluxo da thread thread_id (sem verificação de limites)
+  template <typename T>
+  void shuffle(int thread_id, std::vector<T>& vec) { generators_[thread_id].shuffle(vec); }
+
+  /// @brief RNGStream::partial_shuffle() no fluxo da thread thread_id (sem verificação de limites)
+  template <typename T>
+  void partial_shuffle(int thread_id, std::vector<T>& vec, size_t k) {
+    generators_[thread_id].partial_shuffle(vec, k);
+  }
+
+  /// @brief RNGStream::sample_k() no fluxo da thread thread_id (sem verificação de limites)
+  void sample_k(int thread_id, size_t n, size_t k, std::vector<size_t>& out) {
+    generators_[thread_id].sample_k(n, k, out);
+  }
+
+  /// @brief RNGStream::sample_k() com scratch no fluxo da thread thread_id (sem verificação de limites)
+  void sample_k(int thread_id, size_t n, size_t k, std::vector<size_t>& out, std::vector<size_t>& scratch) {
+    generators_[thread_id].sample_k(n, k, out, scratch);
+  }
+
+  /// @brief RNGStream::reservoir_sample() no fluxo da thread thread_id (sem verificação de limites)
+  template <std::input_iterator InputIt>
+  size_t reservoir_sample(int thread_id, InputIt first, InputIt last, std::span<std::iter_value_t<InputIt>> out) {
+    return generators_[thread_id].reservoir_sample(first, last, out);
+  }
+
+  /// @brief RNGStream::random_subset() no fluxo da thread thread_id (sem verificação de limites)
+  void random_subset(int thread_id, std::vector<uint64_t>& bits, size_t n, double p = 0.5) {
+    generators_[thread_id].random_subset(bits, n, p);
   }
 
   /**
-   * @brief Gera um valor booleano com a probabilidade dada
-   * @param thread_id ID da thread chamadora (0 a num_threads-1)
-   * @param p Probabilidade de retornar verdadeiro (padrão 0.5)
-   * @return true com probabilidade p, false com probabilidade (1-p)
+   * @brief Grava um checkpoint binário de todos os fluxos
+   * @param os Destino, aberto em modo binário
+   * @throws std::runtime_error Se a escrita falhar.
    *
-   * @warning thread_id deve estar dentro do intervalo válido, sem verificação
-   * de limites
-   * @warning p deve estar no intervalo [0.0, 1.0], sem validação
+   * Grava um identificador de formato, o nome do motor, a semente mestre, o
+   * número de threads e o estado de cada fluxo (RNGStream::save()). Depois de
+   * load(), todos os fluxos continuam exatamente de onde estavam, então um
+   * resolvedor retomado de um checkpoint segue a mesma trajetória. As
+   * associações de local() pertencem ao processo e não são gravadas.
+   *
+   * @warning Nenhuma thread deve estar usando o RNG durante a gravação.
    */
-  bool bernoulli(int thread_id, double p = 0.5) {
-    std::bernoulli_distribution dist(p);
-    return dist(generators_[thread_id]);
+  void save(std::ostream& os) const {
+    Stream::write_u64(os, CHECKPOINT_MAGIC);
+    Stream::write_u64(os, RNG_ENGINE_NAME<Engine>.size());
+    os.write(RNG_ENGINE_NAME<Engine>.data(), static_cast<std::streamsize>(RNG_ENGINE_NAME<Engine>.size()));
+    Stream::write_u64(os, master_seed_);
+    Stream::write_u64(os, static_cast<uint64_t>(num_threads_));
+    for (const Stream& stream : generators_) {
+      stream.save(os);
+    }
+    if (!os) {
+      throw std::runtime_error("BasicRNG::save: falha ao gravar o checkpoint");
+    }
   }
 
   /**
-   * @brief Embaralha aleatoriamente os elementos de um vetor
-   * @tparam T Tipo do elemento do vetor
-   * @param thread_id ID da thread chamadora (0 a num_threads-1)
-   * @param vec Vetor a ser embaralhado (modificado no local)
+   * @brief Restaura um checkpoint gravado por save()
+   * @param is Origem, aberta em modo binário
+   * @throws std::runtime_error Se o checkpoint estiver truncado, for de outro
+   * formato ou motor, ou tiver outro número de threads. Nesse caso o RNG não
+   * é alterado.
    *
-   * Útil para gerar permutações aleatórias em problemas como TSP,
-   * problemas de alocação e outras tarefas de otimização combinatória.
+   * Referências obtidas com local() ou stream() continuam válidas.
    *
-   * @warning thread_id deve estar dentro do intervalo válido, sem verificação
-   * de limites
+   * @warning Nenhuma thread deve estar usando o RNG durante a restauração.
    */
-  template <typename T>
-  void shuffle(int thread_id, std::vector<T>& vec) {
-    std::shuffle(vec.begin(), vec.end(), generators_[thread_id]);
+  void load(std::istream& is) {
+    if (Stream::read_u64(is) != CHECKPOINT_MAGIC) {
+      throw std::runtime_error("BasicRNG::load: não é um checkpoint de RNG");
+    }
+    const uint64_t name_size = Stream::read_u64(is);
+    std::string name(std::min<uint64_t>(name_size, 64), '\0');
+    if (name_size > 64 || !is.read(name.data(), static_cast<std::streamsize>(name.size())) ||
+        name != RNG_ENGINE_NAME<Engine>) {
+      throw std::runtime_error("BasicRNG::load: checkpoint de outro motor");
+    }
+    const uint64_t seed = Stream::read_u64(is);
+    if (Stream::read_u64(is) != static_cast<uint64_t>(num_threads_)) {
+      throw std::runtime_error("BasicRNG::load: número de threads diferente do checkpoint");
+    }
+
+    std::vector<Stream> restored(generators_);
+    for (Stream& stream : restored) {
+      stream.load(is);
+    }
+    std::copy(restored.begin(), restored.end(), generators_.begin());
+    master_seed_ = seed;
   }
 
   /**
@@ -162,3 +1083,21 @@ class RNG {
    */
   [[nodiscard]] uint64_t get_master_seed() const { return master_seed_; }
 };
+
+/**
+ * @brief RNG padrão, com Mersenne Twister (sequências compatíveis com as
+ * versões anteriores)
+ */
+using RNG = BasicRNG<std::mt19937_64>;
+
+/**
+ * @brief RNG com xoshiro256++: estado de 32 bytes por thread, indicado para
+ * laços quentes de meta-heurísticas
+ */
+using FastRNG = BasicRNG<Xoshiro256PlusPlus>;
+
+/// @brief RNG com PCG64
+using PcgRNG = BasicRNG<Pcg64>;
+
+/// @brief RNG com SplitMix64 (o menor estado, período 2^64)
+using SplitMixRNG = BasicRNG<SplitMix64>;
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+/**
+ * @file
+ * @brief Motores pseudoaleatórios rápidos para RNG
+ *
+ * Todos satisfazem UniformRandomBitGenerator, produzem 64 bits por chamada e
+ * são construídos ou re-semeados a partir de uma única semente de 64 bits,
+ * como std::mt19937_64, então podem ser usados diretamente em BasicRNG e nas
+ * distribuições da biblioteca padrão. Como os motores padrão, gravam e leem o
+ * estado completo em texto com << e >> (palavras decimais separadas por
+ * espaço), o que permite salvar e restaurar a sequência exatamente.
+ */
+
+/**
+ * @class SplitMix64
+ * @brief Gerador SplitMix64 (Steele, Lea e Flood)
+ *
+ * Estado de 64 bits e uma multiplicação-xorshift por número. Muito rápido,
+ * mas com período 2^64; indicado para derivar sementes e para laços curtos.
+ */
+class SplitMix64 {
+ private:
+  uint64_t state_;  ///< Contador de Weyl
+
+ public:
+  using result_type = uint64_t;
+
+  /**
+   * @brief Constrói o gerador
+   * @param seed Semente (qualquer valor, inclusive 0)
+   */
+  explicit SplitMix64(uint64_t seed = 0) noexcept : state_(seed) {}
+
+  /**
+   * @brief Re-inicializa o gerador
+   * @param seed Nova semente
+   */
+  void seed(uint64_t seed) noexcept { state_ = seed; }
+
+  static constexpr result_type min() noexcept { return 0; }
+  static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /**
+   * @brief Gera o próximo valor
+   * @return Valor uniforme em [0, 2^64)
+   */
+  result_type operator()() noexcept {
+    uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+  /**
+   * @brief Avança o gerador delta passos em O(1)
+   * @param delta Número de valores pulados
+   */
+  void advance(uint64_t delta) noexcept { state_ += delta * 0x9e3779b97f4a7c15ULL; }
+
+  bool operator==(const SplitMix64&) const noexcept = default;
+
+  friend std::ostream& operator<<(std::ostream& os, const SplitMix64& engine) { return os << engine.state_; }
+  friend std::istream& operator>>(std::istream& is, SplitMix64& engine) { return is >> engine.state_; }
+};
+
+/**
+ * @class Xoshiro256PlusPlus
+ * @brief Gerador xoshiro256++ (Blackman e Vigna)
+ *
+ * Estado de 256 bits, período 2^256 - 1 e apenas somas, xors e rotações por
+ * número. O estado é preenchido a partir da semente com SplitMix64, como
+ * recomendam os autores, então nunca fica todo nulo. jump() e long_jump()
+ * separam subsequências garantidamente disjuntas do mesmo período.
+ */
+class Xoshiro256PlusPlus {
+ private:
+  uint64_t state_[4];  ///< Estado (nunca todo nulo)
+
+  /// Aplica o polinômio de salto dado (equivale a avançar 2^128 ou 2^192 passos)
+  void apply_jump(const uint64_t (&polynomial)[4]) noexcept {
+    uint64_t jumped[4] = {0, 0, 0, 0};
+    for (uint64_t word : polynomial) {
+      for (int bit = 0; bit < 64; ++bit) {
+        if (word & (uint64_t{1} << bit)) {
+          for (int i = 0; i < 4; ++i) {
+            jumped[i] ^= state_[i];
+          }
+        }
+        (*this)();
+      }
+    }
+    for (int i = 0; i < 4; ++i) {
+      state_[i] = jumped[i];
+    }
+  }
+
+ public:
+  using result_type = uint64_t;
+
+  /**
+   * @brief Constrói o gerador
+   * @param seed Semente expandida por SplitMix64
+   */
+  explicit Xoshiro256PlusPlus(uint64_t seed = 0) noexcept { this->seed(seed); }
+
+  /**
+   * @brief Re-inicializa o gerador
+   * @param seed Nova semente expandida por SplitMix64
+   */
+  void seed(uint64_t seed) noexcept {
+    SplitMix64 expand(seed);
+    for (uint64_t& word : state_) {
+      word = expand();
+    }
+  }
+
+  static constexpr result_type min() noexcept { return 0; }
+  static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /**
+   * @brief Gera o próximo valor
+   * @return Valor uniforme em [0, 2^64)
+   */
+  result_type operator()() noexcept {
+    const uint64_t result = std::rotl(state_[0] + state_[3], 23) + state_[0];
+    const uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = std::rotl(state_[3], 45);
+    return result;
+  }
+
+  /**
+   * @brief Avança 2^128 passos
+   *
+   * Gera até 2^128 subsequências sem sobreposição, cada uma com 2^128
+   * valores, por exemplo uma por thread.
+   */
+  void jump() noexcept {
+    static constexpr uint64_t JUMP[4] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL,
+                                         0x39abdc4529b1661cULL};
+    apply_jump(JUMP);
+  }
+
+  /**
+   * @brief Avança 2^192 passos
+   *
+   * Gera até 2^64 blocos disjuntos, cada um subdividido por jump(), por
+   * exemplo um por ilha ou reinício em execuções distribuídas.
+   */
+  void long_jump() noexcept {
+    static constexpr uint64_t LONG_JUMP[4] = {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL,
+                                              0x39109bb02acbe635ULL};
+    apply_jump(LONG_JUMP);
+  }
+
+  bool operator==(const Xoshiro256PlusPlus&) const noexcept = default;
+
+  friend std::ostream& operator<<(std::ostream& os, const Xoshiro256PlusPlus& engine) {
+    return os << engine.state_[0] << ' ' << engine.state_[1] << ' ' << engine.state_[2] << ' ' << engine.state_[3];
+  }
+
+  friend std::istream& operator>>(std::istream& is, Xoshiro256PlusPlus& engine) {
+    uint64_t state[4];
+    if (is >> state[0] >> state[1] >> state[2] >> state[3]) {
+      for (int i = 0; i < 4; ++i) {
+        engine.state_[i] = state[i];
+      }
+    }
+    return is;
+  }
+};
+
+/**
+ * @class Pcg64
+ * @brief Gerador PCG64 (O'Neill): congruencial linear de 128 bits com saída XSL-RR
+ *
+ * Estado e incremento de 128 bits; período 2^128 por fluxo. Semente e
+ * incremento são derivados da semente de 64 bits com SplitMix64. advance()
+ * pula qualquer número de passos em O(log delta).
+ *
+ * @warning Requer unsigned __int128 (GCC e Clang).
+ */
+class Pcg64 {
+ private:
+  using uint128 = unsigned __int128;
+
+  static constexpr uint128 MULTIPLIER =
+      (static_cast<uint128>(0x2360ed051fc65da4ULL) << 64) | static_cast<uint128>(0x4385df649fccf645ULL);
+
+  uint128 state_;      ///< Estado do gerador congruencial
+  uint128 increment_;  ///< Incremento (sempre ímpar), seleciona o fluxo
+
+  void step() noexcept { state_ = state_ * MULTIPLIER + increment_; }
+
+ public:
+  using result_type = uint64_t;
+  using difference_type = uint128;  ///< Tipo de delta em advance()
+
+  /**
+   * @brief Constrói o gerador
+   * @param seed Semente expandida por SplitMix64
+   */
+  explicit Pcg64(uint64_t seed = 0) noexcept { this->seed(seed); }
+
+  /**
+   * @brief Re-inicializa o gerador
+   * @param seed Nova semente expandida por SplitMix64
+   */
+  void seed(uint64_t seed) noexcept {
+    SplitMix64 expand(seed);
+    const uint128 initial = (static_cast<uint128>(expand()) << 64) | expand();
+    increment_ = (((static_cast<uint128>(expand()) << 64) | expand()) << 1) | 1;
+    state_ = 0;
+    step();
+    state_ += initial;
+    step();
+  }
+
+  static constexpr result_type min() noexcept { return 0; }
+  static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  /**
+   * @brief Gera o próximo valor
+   * @return Valor uniforme em [0, 2^64)
+   */
+  result_type operator()() noexcept {
+    const uint128 old = state_;
+    step();
+    const auto folded = static_cast<uint64_t>(old >> 64) ^ static_cast<uint64_t>(old);
+    return std::rotr(folded, static_cast<int>(old >> 122));
+  }
+
+  /**
+   * @brief Avança o gerador delta passos em O(log delta) (Brown, "Random
+   * number generation with arbitrary strides")
+   * @param delta Número de valores pulados (módulo 2^128)
+   */
+  void advance(uint128 delta) noexcept {
+    uint128 multiplier = MULTIPLIER;
+    uint128 increment = increment_;
+    uint128 total_multiplier = 1;
+    uint128 total_increment = 0;
+    while (delta > 0) {
+      if (delta & 1) {
+        total_multiplier *= multiplier;
+        total_increment = total_increment * multiplier + increment;
+      }
+      increment *= multiplier + 1;
+      multiplier *= multiplier;
+      delta >>= 1;
+    }
+    state_ = total_multiplier * state_ + total_increment;
+  }
+
+  bool operator==(const Pcg64&) const noexcept = default;
+
+  friend std::ostream& operator<<(std::ostream& os, const Pcg64& engine) {
+    return os << static_cast<uint64_t>(engine.state_ >> 64) << ' ' << static_cast<uint64_t>(engine.state_) << ' '
+              << static_cast<uint64_t>(engine.increment_ >> 64) << ' ' << static_cast<uint64_t>(engine.increment_);
+  }
+
+  friend std::istream& operator>>(std::istream& is, Pcg64& engine) {
+    uint64_t words[4];
+    if (is >> words[0] >> words[1] >> words[2] >> words[3]) {
+      engine.state_ = (static_cast<uint128>(words[0]) << 64) | words[1];
+      engine.increment_ = (static_cast<uint128>(words[2]) << 64) | words[3];
+    }
+    return is;
+  }
+};
@@ -0,0 +1,382 @@
+#include "common/random_generators.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Unidades de trabalho (linhas, pontos ou vértices) por bloco; fixo para não depender das threads.
+constexpr size_t BLOCK_SIZE = 4096;
+
+/// Trocas tentadas por aresta de random_regular_graph antes de recomeçar o emparelhamento.
+constexpr size_t MAX_SWAP_ATTEMPTS = 1024;
+
+/// Emparelhamentos tentados por random_regular_graph antes de desistir.
+constexpr size_t MAX_PAIRING_RESTARTS = 1024;
+
+using Edge = std::pair<size_t, size_t>;
+
+/// Finalizador do SplitMix64.
+constexpr uint64_t mix(uint64_t x) noexcept {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/// Valor pseudoaleatório determinado por (semente, índice).
+constexpr uint64_t hash(uint64_t seed, uint64_t index) noexcept { return mix(seed ^ mix(index)); }
+
+/// Inteiro em [0, bound) a partir de 64 bits aleatórios (multiplicação de 128 bits).
+constexpr size_t scale(uint64_t bits, size_t bound) noexcept {
+  return static_cast<size_t>((static_cast<unsigned __int128>(bits) * bound) >> 64);
+}
+
+/// Fluxo SplitMix64 de um bloco de trabalho.
+class Stream {
+ private:
+  uint64_t state_;
+
+ public:
+  Stream(uint64_t seed, uint64_t block) : state_(hash(seed, block)) {}
+
+  uint64_t next() noexcept { return mix(state_++); }
+
+  /// Real uniforme em [0, 1).
+  double uniform() noexcept { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+  /// Inteiro uniforme em [0, bound).
+  size_t below(size_t bound) noexcept { return scale(next(), bound); }
+};
+
+size_t num_blocks(size_t units) { return (units + BLOCK_SIZE - 1) / BLOCK_SIZE; }
+
+/// Monta o grafo a partir das arestas de cada bloco, na ordem dos blocos.
+Graph from_edge_blocks(size_t n, const std::vector<std::vector<Edge>>& blocks, bool deduplicate) {
+  std::vector<size_t> degree(n, 0);
+  for (const auto& block : blocks) {
+    for (const auto& [u, v] : block) {
+      ++degree[u];
+      ++degree[v];
+    }
+  }
+
+  std::vector<std::vector<size_t>> adjacency(n);
+  for (size_t v = 0; v < n; ++v) {
+    adjacency[v].reserve(degree[v]);
+  }
+  for (const auto& block : blocks) {
+    for (const auto& [u, v] : block) {
+      adjacency[u].push_back(v);
+      adjacency[v].push_back(u);
+    }
+  }
+
+  if (deduplicate) {
+    const auto count = static_cast<int64_t>(n);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int64_t i = 0; i < count; ++i) {
+      auto& neighbors = adjacency[static_cast<size_t>(i)];
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+  }
+
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+Graph empty_graph(size_t n) { return Graph::from_adjacency(std::vector<std::vector<size_t>>(n)); }
+
+/// Emparelha as n * d pontas com a semente dada e elimina laços e arestas múltiplas por trocas
+/// aleatórias. Retorna false se alguma aresta não puder ser corrigida em MAX_SWAP_ATTEMPTS trocas.
+bool regular_pairing(size_t n, size_t d, uint64_t seed, Stream& stream,
+                     std::vector<std::vector<size_t>>& adjacency) {
+  const size_t stubs = n * d;
+
+  // Permutação aleatória das pontas: chaves sorteadas em paralelo, desempate pelo índice
+  std::vector<std::pair<uint64_t, size_t>> keys(stubs);
+  const auto count = static_cast<int64_t>(stubs);
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto s = static_cast<size_t>(i);
+    keys[s] = {hash(seed, s), s};
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<Edge> edges(stubs / 2);
+  adjacency.assign(n, {});
+  for (size_t v = 0; v < n; ++v) {
+    adjacency[v].reserve(d);
+  }
+  for (size_t e = 0; e < edges.size(); ++e) {
+    const size_t a = keys[2 * e].second / d;
+    const size_t b = keys[2 * e + 1].second / d;
+    edges[e] = {a, b};
+    adjacency[a].push_back(b);
+    adjacency[b].push_back(a);
+  }
+
+  auto multiplicity = [&](size_t a, size_t b) {
+    return static_cast<size_t>(std::count(adjacency[a].begin(), adjacency[a].end(), b));
+  };
+  auto unlink = [&](size_t a, size_t b) {
+    adjacency[a].erase(std::find(adjacency[a].begin(), adjacency[a].end(), b));
+    adjacency[b].erase(std::find(adjacency[b].begin(), adjacency[b].end(), a));
+  };
+  auto link = [&](size_t a, size_t b) {
+    adjacency[a].push_back(b);
+    adjacency[b].push_back(a);
+  };
+
+  // Troca {a, b}, {c, e} por {a, c}, {b, e} até não restarem laços nem arestas múltiplas. Em grafos
+  // densos pode não existir troca válida (um laço em v cujos dois vizinhos faltantes já são adjacentes).
+  for (size_t e = 0; e < edges.size(); ++e) {
+    size_t attempts = 0;
+    for (;;) {
+      const auto [a, b] = edges[e];
+      if (a != b && multiplicity(a, b) == 1) {
+        break;
+      }
+      if (++attempts > MAX_SWAP_ATTEMPTS) {
+        return false;
+      }
+      const size_t other = stream.below(edges.size());
+      auto [c, f] = edges[other];
+      if ((stream.next() & 1) != 0) {
+        std::swap(c, f);
+      }
+      const bool same_pair = (a == f && c == b) || (a == b && c == f);
+      if (other == e || a == c || b == f || same_pair || multiplicity(a, c) > 0 || multiplicity(b, f) > 0) {
+        continue;
+      }
+      unlink(a, b);
+      unlink(c, f);
+      link(a, c);
+      link(b, f);
+      edges[e] = {a, c};
+      edges[other] = {b, f};
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Graph erdos_renyi_graph(size_t n, double p, RNG& rng, int thread_id) {
+  const uint64_t seed = rng.next_u64(thread_id);
+  if (p <= 0.0 || n < 2) {
+    return empty_graph(n);
+  }
+
+  std::vector<std::vector<Edge>> blocks(num_blocks(n));
+  const double log_q = std::log1p(-std::min(p, 1.0));
+  const auto count = static_cast<int64_t>(blocks.size());
+
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int64_t b = 0; b < count; ++b) {
+    const auto block = static_cast<size_t>(b);
+    const size_t end = std::min(n, (block + 1) * BLOCK_SIZE);
+    Stream stream(seed, block);
+    std::vector<Edge>& edges = blocks[block];
+
+    // Pares (v, w) com w < v, linha por linha; w = v significa "antes do início da linha v"
+    size_t v = std::max<size_t>(block * BLOCK_SIZE, 1);
+    size_t w = 0;
+    bool first = true;
+    while (v < end) {
+      size_t skip = 0;
+      if (p < 1.0) {
+        const double jump = std::floor(std::log1p(-stream.uniform()) / log_q);
+        skip = jump < static_cast<double>(n) * static_cast<double>(n) ? static_cast<size_t>(jump) : n * n;
+      }
+      w += first ? skip : skip + 1;
+      first = false;
+      while (v < end && w >= v) {
+        w -= v;
+        ++v;
+      }
+      if (v < end) {
+        edges.emplace_back(v, w);
+      }
+    }
+  }
+
+  return from_edge_blocks(n, blocks, false);
+}
+
+Graph barabasi_albert_graph(size_t n, size_t m, RNG& rng, int thread_id) {
+  if (m == 0) {
+    throw std::invalid_argument("barabasi_albert_graph: m deve ser positivo");
+  }
+  const uint64_t seed = rng.next_u64(thread_id);
+
+  // Arestas do clique inicial em ordem: (1, 0), (2, 0), (2, 1), ...
+  std::vector<Edge> clique;
+  for (size_t v = 1; v <= m && v < n; ++v) {
+    for (size_t u = 0; u < v; ++u) {
+      clique.emplace_back(v, u);
+    }
+  }
+  if (n <= m + 1) {
+    return from_edge_blocks(n, {clique}, false);
+  }
+
+  const size_t base = clique.size();
+  const size_t total = base + (n - m - 1) * m;
+  auto source = [&](size_t slot) { return slot < base ? clique[slot].first : m + 1 + (slot - base) / m; };
+
+  // Alvo da aresta slot: um extremo uniforme das arestas anteriores ao vértice de origem, seguindo a
+  // cadeia enquanto o extremo sorteado for outro alvo ainda não resolvido.
+  auto target = [&](size_t slot) {
+    for (;;) {
+      if (slot < base) {
+        return clique[slot].second;
+      }
+      const size_t v = source(slot);
+      const size_t first = base + (v - m - 1) * m;
+      const size_t r = scale(hash(seed, slot), 2 * first);
+      if (r % 2 == 0) {
+        return source(r / 2);
+      }
+      slot = r / 2;
+    }
+  };
+
+  std::vector<std::vector<Edge>> blocks(num_blocks(total - base) + 1);
+  blocks[0] = clique;
+  const auto count = static_cast<int64_t>(blocks.size() - 1);
+
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int64_t b = 0; b < count; ++b) {
+    const auto block = static_cast<size_t>(b);
+    const size_t begin = base + block * BLOCK_SIZE;
+    const size_t end = std::min(total, begin + BLOCK_SIZE);
+    std::vector<Edge>& edges = blocks[block + 1];
+    edges.reserve(end - begin);
+    for (size_t slot = begin; slot < end; ++slot) {
+      edges.emplace_back(source(slot), target(slot));
+    }
+  }
+
+  return from_edge_blocks(n, blocks, true);
+}
+
+Graph random_geometric_graph(size_t n, double radius, RNG& rng, int thread_id) {
+  if (radius <= 0.0) {
+    throw std::invalid_argument("random_geometric_graph: raio deve ser positivo");
+  }
+  const uint64_t seed = rng.next_u64(thread_id);
+
+  std::vector<double> x(n);
+  std::vector<double> y(n);
+  const auto point_blocks = static_cast<int64_t>(num_blocks(n));
+#pragma omp parallel for schedule(static)
+  for (int64_t b = 0; b < point_blocks; ++b) {
+    const auto block = static_cast<size_t>(b);
+    Stream stream(seed, block);
+    for (size_t v = block * BLOCK_SIZE; v < std::min(n, (block + 1) * BLOCK_SIZE); ++v) {
+      x[v] = stream.uniform();
+      y[v] = stream.uniform();
+    }
+  }
+
+  // Células de lado >= radius em CSR (ordenação por contagem, estável)
+  const auto side = static_cast<size_t>(std::clamp(std::floor(1.0 / radius), 1.0, std::sqrt(static_cast<double>(n)) + 1));
+  auto cell_of = [&](size_t v) {
+    const auto cx = std::min(side - 1, static_cast<size_t>(x[v] * static_cast<double>(side)));
+    const auto cy = std::min(side - 1, static_cast<size_t>(y[v] * static_cast<double>(side)));
+    return std::pair{cx, cy};
+  };
+  std::vector<size_t> offsets(side * side + 1, 0);
+  for (size_t v = 0; v < n; ++v) {
+    const auto [cx, cy] = cell_of(v);
+    ++offsets[cx * side + cy + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<size_t> members(n);
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t v = 0; v < n; ++v) {
+    const auto [cx, cy] = cell_of(v);
+    members[next[cx * side + cy]++] = v;
+  }
+
+  std::vector<std::vector<size_t>> adjacency(n);
+  const double radius2 = radius * radius;
+  const auto count = static_cast<int64_t>(n);
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto v = static_cast<size_t>(i);
+    const auto [cx, cy] = cell_of(v);
+    for (size_t nx = cx == 0 ? 0 : cx - 1; nx <= std::min(side - 1, cx + 1); ++nx) {
+      for (size_t ny = cy == 0 ? 0 : cy - 1; ny <= std::min(side - 1, cy + 1); ++ny) {
+        const size_t cell = nx * side + ny;
+        for (size_t k = offsets[cell]; k < offsets[cell + 1]; ++k) {
+          const size_t u = members[k];
+          const double dx = x[u] - x[v];
+          const double dy = y[u] - y[v];
+          if (u != v && dx * dx + dy * dy <= radius2) {
+            adjacency[v].push_back(u);
+          }
+        }
+      }
+    }
+  }
+
+  return Graph::from_adjacency(std::move(adjacency));
+}
+
+Graph watts_strogatz_graph(size_t n, size_t k, double beta, RNG& rng, int thread_id) {
+  if (k % 2 != 0 || (k >= n && k > 0)) {
+    throw std::invalid_argument("watts_strogatz_graph: k deve ser par e menor que n");
+  }
+  const uint64_t seed = rng.next_u64(thread_id);
+
+  std::vector<std::vector<Edge>> blocks(num_blocks(n));
+  const auto count = static_cast<int64_t>(blocks.size());
+#pragma omp parallel for schedule(static)
+  for (int64_t b = 0; b < count; ++b) {
+    const auto block = static_cast<size_t>(b);
+    Stream stream(seed, block);
+    std::vector<Edge>& edges = blocks[block];
+    edges.reserve(BLOCK_SIZE * k / 2);
+    for (size_t v = block * BLOCK_SIZE; v < std::min(n, (block + 1) * BLOCK_SIZE); ++v) {
+      for (size_t j = 1; j <= k / 2; ++j) {
+        size_t w = (v + j) % n;
+        if (stream.uniform() < beta) {
+          w = stream.below(n - 1);
+          w += w >= v ? 1 : 0;
+        }
+        edges.emplace_back(v, w);
+      }
+    }
+  }
+
+  return from_edge_blocks(n, blocks, true);
+}
+
+Graph random_regular_graph(size_t n, size_t d, RNG& rng, int thread_id) {
+  if ((n > 0 && d >= n) || (n * d) % 2 != 0) {
+    throw std::invalid_argument("random_regular_graph: exige d < n e n * d par");
+  }
+  const uint64_t seed = rng.next_u64(thread_id);
+  if (n * d == 0) {
+    return empty_graph(n);
+  }
+
+  // Os recomeços usam sementes do mesmo fluxo das trocas, então o resultado continua reprodutível
+  Stream stream(seed, ~uint64_t{0});
+  std::vector<std::vector<size_t>> adjacency;
+  uint64_t pairing_seed = seed;
+  for (size_t restart = 0; restart < MAX_PAIRING_RESTARTS; ++restart) {
+    if (regular_pairing(n, d, pairing_seed, stream, adjacency)) {
+      return Graph::from_adjacency(std::move(adjacency));
+    }
+    pairing_seed = stream.next();
+  }
+  throw std::runtime_error("random_regular_graph: nenhum emparelhamento simples encontrado");
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+
+#include "common/graph.hpp"
+#include "common/random.hpp"
+
+/// @file
+/// Geradores de grafos aleatórios reprodutíveis.
+///
+/// Cada gerador sorteia uma única semente base de rng (no fluxo de thread_id) e divide o trabalho em
+/// blocos de tamanho fixo, cada um com seu próprio fluxo derivado de (semente base, índice do bloco).
+/// Os blocos são processados em paralelo com OpenMP e combinados em ordem, então o grafo depende só da
+/// semente e nunca do número de threads.
+
+/// @brief Erdős–Rényi G(n, p) com saltos geométricos, O(n + m) esperado.
+///
+/// Os pares {v, w} com w < v são percorridos linha a linha e o próximo par sorteado é obtido pulando
+/// floor(log(1 - u) / log(1 - p)) pares (Batagelj–Brandes).
+///
+/// @param n Número de vértices.
+/// @param p Probabilidade de cada aresta (p <= 0: sem arestas; p >= 1: completo).
+/// @param rng Fonte da semente.
+/// @param thread_id Fluxo de rng usado para a semente.
+/// @return Grafo aleatório.
+[[nodiscard]] Graph erdos_renyi_graph(size_t n, double p, RNG& rng, int thread_id = 0);
+
+/// @brief Barabási–Albert com anexação preferencial, O(n * m) esperado.
+///
+/// Os vértices 0..m formam K_{m+1}; cada vértice seguinte liga-se a m vértices anteriores com
+/// probabilidade proporcional ao grau. Segue o modelo de cópia em lista de arestas: o alvo da aresta i
+/// é um extremo sorteado de uma aresta anterior, definido por uma função determinística de i, o que
+/// permite sortear todas as arestas em paralelo. Alvos repetidos de um mesmo vértice são fundidos,
+/// então alguns vértices podem receber menos de m arestas (raro quando n >> m).
+///
+/// @param n Número de vértices.
+/// @param m Arestas por vértice novo (m >= 1).
+/// @param rng Fonte da semente.
+/// @param thread_id Fluxo de rng usado para a semente.
+/// @return Grafo aleatório.
+/// @throws std::invalid_argument Se m == 0.
+[[nodiscard]] Graph barabasi_albert_graph(size_t n, size_t m, RNG& rng, int thread_id = 0);
+
+/// @brief Grafo geométrico aleatório no quadrado unitário, O(n + m) esperado.
+///
+/// Pontos uniformes ligados quando a distância euclidiana é no máximo radius. Os pontos são
+/// distribuídos em células de lado radius e cada vértice só examina as 9 células vizinhas.
+///
+/// @param n Número de vértices.
+/// @param radius Raio de conexão.
+/// @param rng Fonte da semente.
+/// @param thread_id Fluxo de rng usado para a semente.
+/// @return Grafo aleatório.
+/// @throws std::invalid_argument Se radius <= 0.
+[[nodiscard]] Graph random_geometric_graph(size_t n, double radius, RNG& rng, int thread_id = 0);
+
+/// @brief Watts–Strogatz: anel com k vizinhos por vértice e religação com probabilidade beta.
+///
+/// Cada aresta {v, v + j} (1 <= j <= k/2) troca o extremo v + j por um vértice uniforme diferente de v
+/// com probabilidade beta. As decisões de cada aresta são independentes; arestas que coincidem após a
+/// religação são fundidas.
+///
+/// @param n Número de vértices.
+/// @param k Grau do anel (par, k < n).
+/// @param beta Probabilidade de religação.
+/// @param rng Fonte da semente.
+/// @param thread_id Fluxo de rng usado para a semente.
+/// @return Grafo aleatório.
+/// @throws std::invalid_argument Se k for ímpar ou k >= n.
+[[nodiscard]] Graph watts_strogatz_graph(size_t n, size_t k, double beta, RNG& rng, int thread_id = 0);
+
+/// @brief Grafo d-regular aleatório pelo modelo de configuração com trocas de arestas.
+///
+/// As n * d pontas são emparelhadas por uma permutação aleatória (chaves sorteadas em paralelo) e laços
+/// ou arestas múltiplas são eliminados por trocas aleatórias que preservam os graus. Se alguma aresta
+/// não puder ser corrigida (comum em grafos pequenos e densos), o emparelhamento recomeça com uma nova
+/// semente do mesmo fluxo, então o resultado continua determinado pela semente.
+///
+/// @param n Número de vértices.
+/// @param d Grau (d < n e n * d par).
+/// @param rng Fonte da semente.
+/// @param thread_id Fluxo de rng usado para a semente.
+/// @return Grafo d-regular.
+/// @throws std::invalid_argument Se d >= n (com n > 0) ou n * d for ímpar.
+/// @throws std::runtime_error Se nenhum de 1024 emparelhamentos puder ser corrigido.
+[[nodiscard]] Graph random_regular_graph(size_t n, size_t d, RNG& rng, int thread_id = 0);
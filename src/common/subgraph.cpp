@@ -0,0 +1,38 @@
+#include "common/subgraph.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+InducedSubgraph induced_subgraph(const Graph& graph, std::span<const size_t> vertices) {
+  InducedSubgraph sub;
+  sub.to_original.assign(vertices.begin(), vertices.end());
+  sub.to_subgraph.assign(graph.order(), InducedSubgraph::NOT_IN_SUBGRAPH);
+
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    const size_t v = vertices[i];
+    if (v >= graph.order()) {
+      throw std::out_of_range("induced_subgraph: vértice inválido");
+    }
+    if (sub.to_subgraph[v] != InducedSubgraph::NOT_IN_SUBGRAPH) {
+      throw std::invalid_argument("induced_subgraph: vértice repetido");
+    }
+    sub.to_subgraph[v] = i;
+  }
+
+  std::vector<std::vector<size_t>> adjacency(vertices.size());
+  const auto count = static_cast<int64_t>(vertices.size());
+#pragma omp parallel for schedule(dynamic, 256) if (vertices.size() >= PARALLEL_SUBGRAPH_THRESHOLD)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto k = static_cast<size_t>(i);
+    std::vector<size_t>& neighbors = adjacency[k];
+    for (size_t u : graph.neighbors_span(vertices[k])) {
+      if (sub.to_subgraph[u] != InducedSubgraph::NOT_IN_SUBGRAPH) {
+        neighbors.push_back(sub.to_subgraph[u]);
+      }
+    }
+  }
+
+  sub.graph = Graph::from_adjacency(std::move(adjacency));
+  return sub;
+}
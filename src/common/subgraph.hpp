@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Tamanho de S a partir do qual induced_subgraph() monta as listas em paralelo.
+inline constexpr size_t PARALLEL_SUBGRAPH_THRESHOLD = 4096;
+
+/// @brief Subgrafo induzido com vértices renumerados de 0 a |S|-1.
+struct InducedSubgraph {
+  static constexpr size_t NOT_IN_SUBGRAPH = std::numeric_limits<size_t>::max();
+
+  Graph graph;
+  std::vector<size_t> to_original;  ///< Vértice original de cada vértice do subgrafo (a ordem de S)
+  std::vector<size_t> to_subgraph;  ///< Novo id de cada vértice original (NOT_IN_SUBGRAPH fora de S)
+};
+
+/// @brief Extrai G[S] em uma passada linear, O(n + soma dos graus de S).
+///
+/// O vértice vertices[i] vira o vértice i, e as listas de adjacência são filtradas e renumeradas
+/// diretamente, sem add_edge(). Para |S| >= PARALLEL_SUBGRAPH_THRESHOLD as listas são montadas em
+/// paralelo com OpenMP. A ordem relativa dos vizinhos é preservada.
+///
+/// @param graph Grafo.
+/// @param vertices Conjunto S, sem repetições.
+/// @return Subgrafo e mapeamentos nos dois sentidos.
+/// @throws std::out_of_range Se algum vértice for inválido.
+/// @throws std::invalid_argument Se algum vértice aparecer mais de uma vez.
+[[nodiscard]] InducedSubgraph induced_subgraph(const Graph& graph, std::span<const size_t> vertices);
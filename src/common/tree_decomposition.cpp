@@ -0,0 +1,259 @@
+#include "common/tree_decomposition.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/// @brief Grafo de eliminação com listas de adjacência ordenadas.
+class EliminationGraph {
+ private:
+  std::vector<std::vector<size_t>> adj_;
+
+ public:
+  explicit EliminationGraph(const Graph& graph) : adj_(graph.order()) {
+    for (size_t v = 0; v < graph.order(); ++v) {
+      const auto neighbors = graph.neighbors_span(v);
+      adj_[v].assign(neighbors.begin(), neighbors.end());
+      std::sort(adj_[v].begin(), adj_[v].end());
+    }
+  }
+
+  [[nodiscard]] const std::vector<size_t>& neighbors(size_t v) const noexcept { return adj_[v]; }
+
+  [[nodiscard]] bool adjacent(size_t u, size_t v) const noexcept {
+    return std::binary_search(adj_[u].begin(), adj_[u].end(), v);
+  }
+
+  /// Número de arestas que faltam para N(v) virar clique.
+  [[nodiscard]] size_t fill_in(size_t v) const noexcept {
+    const auto& nv = adj_[v];
+    size_t missing = 0;
+    for (size_t i = 0; i < nv.size(); ++i) {
+      for (size_t j = i + 1; j < nv.size(); ++j) {
+        missing += adjacent(nv[i], nv[j]) ? 0 : 1;
+      }
+    }
+    return missing;
+  }
+
+  /// Remove v transformando sua vizinhança em clique.
+  void eliminate(size_t v) {
+    const std::vector<size_t> nv = std::move(adj_[v]);
+    adj_[v].clear();
+
+    std::vector<size_t> merged;
+    for (size_t u : nv) {
+      auto& nu = adj_[u];
+      nu.erase(std::lower_bound(nu.begin(), nu.end(), v));
+      merged.clear();
+      std::set_union(nu.begin(), nu.end(), nv.begin(), nv.end(), std::back_inserter(merged));
+      merged.erase(std::lower_bound(merged.begin(), merged.end(), u));
+      nu.swap(merged);
+    }
+  }
+};
+
+}  // namespace
+
+size_t TreeDecomposition::width() const noexcept {
+  size_t largest = 0;
+  for (const auto& bag : bags) {
+    largest = std::max(largest, bag.size());
+  }
+  return largest == 0 ? 0 : largest - 1;
+}
+
+std::vector<size_t> elimination_order(const Graph& graph, EliminationHeuristic heuristic) {
+  const size_t n = graph.order();
+  EliminationGraph elim(graph);
+
+  auto score_of = [&](size_t v) {
+    return heuristic == EliminationHeuristic::MIN_FILL ? elim.fill_in(v) : elim.neighbors(v).size();
+  };
+
+  // Fila de prioridade preguiçosa: entradas desatualizadas são descartadas ao sair.
+  using Entry = std::pair<size_t, size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+  std::vector<size_t> score(n);
+  std::vector<char> done(n, 0);
+  for (size_t v = 0; v < n; ++v) {
+    score[v] = score_of(v);
+    queue.emplace(score[v], v);
+  }
+
+  std::vector<size_t> order;
+  order.reserve(n);
+  std::vector<size_t> affected;
+  std::vector<char> mark(n, 0);
+
+  while (!queue.empty()) {
+    const auto [s, v] = queue.top();
+    queue.pop();
+    if (done[v] != 0 || s != score[v]) {
+      continue;
+    }
+
+    done[v] = 1;
+    order.push_back(v);
+
+    // O grau só muda em N(v); o preenchimento também muda para vizinhos de N(v).
+    affected.clear();
+    for (size_t u : elim.neighbors(v)) {
+      if (mark[u] == 0) {
+        mark[u] = 1;
+        affected.push_back(u);
+      }
+      if (heuristic == EliminationHeuristic::MIN_FILL) {
+        for (size_t w : elim.neighbors(u)) {
+          if (w != v && mark[w] == 0) {
+            mark[w] = 1;
+            affected.push_back(w);
+          }
+        }
+      }
+    }
+
+    elim.eliminate(v);
+
+    for (size_t u : affected) {
+      mark[u] = 0;
+      score[u] = score_of(u);
+      queue.emplace(score[u], u);
+    }
+  }
+
+  return order;
+}
+
+TreeDecomposition decompose(const Graph& graph, const std::vector<size_t>& order) {
+  const size_t n = graph.order();
+  if (order.size() != n) {
+    throw std::invalid_argument("decompose: a ordem de eliminação deve conter todos os vértices");
+  }
+
+  std::vector<size_t> position(n, TreeDecomposition::NO_PARENT);
+  for (size_t i = 0; i < n; ++i) {
+    if (order[i] >= n || position[order[i]] != TreeDecomposition::NO_PARENT) {
+      throw std::invalid_argument("decompose: a ordem de eliminação não é uma permutação");
+    }
+    position[order[i]] = i;
+  }
+
+  TreeDecomposition td;
+  td.bags.resize(n);
+  td.parent.assign(n, TreeDecomposition::NO_PARENT);
+
+  EliminationGraph elim(graph);
+  for (size_t i = 0; i < n; ++i) {
+    const size_t v = order[i];
+    auto& bag = td.bags[i];
+    bag = elim.neighbors(v);
+
+    size_t first = n;
+    for (size_t u : bag) {
+      first = std::min(first, position[u]);
+    }
+    if (first != n) {
+      td.parent[i] = first;
+    }
+
+    bag.insert(std::lower_bound(bag.begin(), bag.end(), v), v);
+    elim.eliminate(v);
+  }
+
+  return td;
+}
+
+TreeDecomposition decompose(const Graph& graph, EliminationHeuristic heuristic) {
+  return decompose(graph, elimination_order(graph, heuristic));
+}
+
+NiceTreeDecomposition make_nice(const TreeDecomposition& td) {
+  NiceTreeDecomposition nice;
+  nice.width = td.width();
+
+  auto& nodes = nice.nodes;
+  auto add_node = [&nodes](NiceNodeType type, size_t vertex, size_t left, size_t right, std::vector<size_t> bag) {
+    NiceNode node;
+    node.type = type;
+    node.vertex = vertex;
+    node.left = left;
+    node.right = right;
+    node.bag = std::move(bag);
+    nodes.push_back(std::move(node));
+    return nodes.size() - 1;
+  };
+
+  // Encadeia FORGET/INTRODUCE a partir de top até chegar à bolsa target.
+  auto morph = [&](size_t top, const std::vector<size_t>& target) {
+    std::vector<size_t> bag = nodes[top].bag;
+    std::vector<size_t> removed;
+    std::vector<size_t> added;
+    std::set_difference(bag.begin(), bag.end(), target.begin(), target.end(), std::back_inserter(removed));
+    std::set_difference(target.begin(), target.end(), bag.begin(), bag.end(), std::back_inserter(added));
+
+    for (size_t v : removed) {
+      bag.erase(std::lower_bound(bag.begin(), bag.end(), v));
+      top = add_node(NiceNodeType::FORGET, v, top, NiceNode::NONE, bag);
+    }
+    for (size_t v : added) {
+      bag.insert(std::lower_bound(bag.begin(), bag.end(), v), v);
+      top = add_node(NiceNodeType::INTRODUCE, v, top, NiceNode::NONE, bag);
+    }
+    return top;
+  };
+
+  auto join = [&](size_t left, size_t right) {
+    return add_node(NiceNodeType::JOIN, NiceNode::NONE, left, right, nodes[left].bag);
+  };
+
+  // Nós cuja bolsa está contida na do pai são absorvidos: seus filhos sobem para o primeiro
+  // ancestral não absorvido. Isso evita ramos redundantes que só gerariam JOINs caros.
+  const size_t count = td.bags.size();
+  std::vector<size_t> owner(count);
+  for (size_t t = count; t-- > 0;) {
+    const size_t parent = td.parent[t];
+    const bool absorbed = parent != TreeDecomposition::NO_PARENT &&
+                          std::includes(td.bags[parent].begin(), td.bags[parent].end(), td.bags[t].begin(),
+                                        td.bags[t].end());
+    owner[t] = absorbed ? owner[parent] : t;
+  }
+
+  // Os nós de td já estão em pós-ordem (pai com índice maior), então cada topo está pronto
+  // quando o pai é processado.
+  std::vector<size_t> pending(count, NiceNode::NONE);
+  size_t forest_top = NiceNode::NONE;
+
+  for (size_t t = 0; t < count; ++t) {
+    if (owner[t] != t) {
+      continue;
+    }
+
+    const auto& bag = td.bags[t];
+    size_t current = pending[t];
+    if (current == NiceNode::NONE) {
+      current = morph(add_node(NiceNodeType::LEAF, NiceNode::NONE, NiceNode::NONE, NiceNode::NONE, {}), bag);
+    }
+
+    const size_t parent = td.parent[t] == TreeDecomposition::NO_PARENT ? td.parent[t] : owner[td.parent[t]];
+    if (parent == TreeDecomposition::NO_PARENT) {
+      const size_t closed = morph(current, {});
+      forest_top = forest_top == NiceNode::NONE ? closed : join(forest_top, closed);
+      continue;
+    }
+
+    const size_t lifted = morph(current, td.bags[parent]);
+    pending[parent] = pending[parent] == NiceNode::NONE ? lifted : join(pending[parent], lifted);
+  }
+
+  if (forest_top == NiceNode::NONE) {
+    forest_top = add_node(NiceNodeType::LEAF, NiceNode::NONE, NiceNode::NONE, NiceNode::NONE, {});
+  }
+  nice.root = forest_top;
+  return nice;
+}
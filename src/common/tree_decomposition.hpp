@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Heurística gulosa usada para escolher a ordem de eliminação.
+enum class EliminationHeuristic {
+  MIN_DEGREE,  ///< Elimina o vértice de menor grau no grafo preenchido
+  MIN_FILL,    ///< Elimina o vértice que cria menos arestas de preenchimento
+};
+
+/// @brief Decomposição em árvore (floresta) obtida de uma ordem de eliminação.
+///
+/// O nó i corresponde ao i-ésimo vértice eliminado e sua bolsa contém esse vértice e seus vizinhos
+/// ainda não eliminados. O pai de um nó sempre tem índice maior que o do filho.
+struct TreeDecomposition {
+  static constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+  std::vector<std::vector<size_t>> bags;  ///< Bolsas ordenadas
+  std::vector<size_t> parent;             ///< Pai de cada nó (NO_PARENT nas raízes)
+
+  /// @brief Largura da decomposição (maior bolsa - 1).
+  /// @return Largura, ou 0 se a decomposição for vazia.
+  [[nodiscard]] size_t width() const noexcept;
+};
+
+/// @brief Tipos de nó de uma decomposição em árvore "nice".
+enum class NiceNodeType {
+  LEAF,       ///< Bolsa vazia, sem filhos
+  INTRODUCE,  ///< Bolsa do filho mais um vértice
+  FORGET,     ///< Bolsa do filho menos um vértice
+  JOIN,       ///< Dois filhos com a mesma bolsa
+};
+
+/// @brief Nó de uma decomposição em árvore "nice".
+struct NiceNode {
+  static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+  NiceNodeType type = NiceNodeType::LEAF;
+  size_t vertex = NONE;      ///< Vértice introduzido ou esquecido
+  size_t left = NONE;        ///< Filho (ou filho esquerdo em JOIN)
+  size_t right = NONE;       ///< Filho direito em JOIN
+  std::vector<size_t> bag;   ///< Bolsa ordenada
+};
+
+/// @brief Decomposição "nice" enraizada com bolsa vazia na raiz.
+///
+/// Os nós são armazenados de forma que todo filho precede o pai, então percorrer o vetor em ordem
+/// crescente é uma pós-ordem válida.
+struct NiceTreeDecomposition {
+  std::vector<NiceNode> nodes;
+  size_t root = NiceNode::NONE;
+  size_t width = 0;
+};
+
+/// @brief Calcula uma ordem de eliminação gulosa.
+/// @param graph Grafo.
+/// @param heuristic Critério de escolha do próximo vértice.
+/// @return Vértices na ordem em que são eliminados.
+[[nodiscard]] std::vector<size_t> elimination_order(const Graph& graph, EliminationHeuristic heuristic);
+
+/// @brief Constrói a decomposição em árvore induzida por uma ordem de eliminação.
+/// @param graph Grafo.
+/// @param order Permutação dos vértices.
+/// @return Decomposição com um nó por vértice.
+/// @throws std::invalid_argument Se order não for uma permutação de 0..n-1.
+[[nodiscard]] TreeDecomposition decompose(const Graph& graph, const std::vector<size_t>& order);
+
+/// @brief Constrói uma decomposição em árvore usando a heurística informada.
+/// @param graph Grafo.
+/// @param heuristic Critério de eliminação (padrão: MIN_FILL).
+/// @return Decomposição em árvore do grafo.
+[[nodiscard]] TreeDecomposition decompose(const Graph& graph,
+                                          EliminationHeuristic heuristic = EliminationHeuristic::MIN_FILL);
+
+/// @brief Converte uma decomposição em árvore para a forma "nice".
+///
+/// Raízes da floresta são unidas por nós JOIN de bolsa vazia.
+///
+/// @param td Decomposição em árvore.
+/// @return Decomposição "nice" com a mesma largura.
+[[nodiscard]] NiceTreeDecomposition make_nice(const TreeDecomposition& td);
@@ -0,0 +1,121 @@
+#include "common/triangles.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+/// Pares de vizinhos de um vértice de grau d.
+constexpr size_t wedges(size_t d) noexcept { return d < 2 ? 0 : d * (d - 1) / 2; }
+
+}  // namespace
+
+TriangleCounts count_triangles(const Graph& graph) {
+  const size_t n = graph.order();
+  TriangleCounts counts;
+  counts.per_vertex.assign(n, 0);
+  const auto count = static_cast<int64_t>(n);
+
+  // u precede v na orientação se (grau(u), u) < (grau(v), v)
+  auto precedes = [&](size_t u, size_t v) {
+    return graph.degree(u) != graph.degree(v) ? graph.degree(u) < graph.degree(v) : u < v;
+  };
+
+  // Listas de saída em CSR, ordenadas por id
+  std::vector<size_t> offsets(n + 1, 0);
+  for (size_t v = 0; v < n; ++v) {
+    size_t out = 0;
+    for (size_t u : graph.neighbors_span(v)) {
+      out += precedes(v, u) ? 1 : 0;
+    }
+    offsets[v + 1] = offsets[v] + out;
+  }
+  std::vector<size_t> targets(offsets[n]);
+
+#pragma omp parallel for schedule(dynamic, 256)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto v = static_cast<size_t>(i);
+    size_t next = offsets[v];
+    for (size_t u : graph.neighbors_span(v)) {
+      if (precedes(v, u)) {
+        targets[next++] = u;
+      }
+    }
+    std::sort(targets.begin() + static_cast<std::ptrdiff_t>(offsets[v]),
+              targets.begin() + static_cast<std::ptrdiff_t>(next));
+  }
+
+  size_t total = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : total)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto v = static_cast<size_t>(i);
+    const size_t v_begin = offsets[v];
+    const size_t v_end = offsets[v + 1];
+    size_t found_at_v = 0;
+
+    for (size_t k = v_begin; k < v_end; ++k) {
+      const size_t u = targets[k];
+      size_t a = v_begin;
+      size_t b = offsets[u];
+      size_t found_at_u = 0;
+      while (a < v_end && b < offsets[u + 1]) {
+        if (targets[a] < targets[b]) {
+          ++a;
+        } else if (targets[b] < targets[a]) {
+          ++b;
+        } else {
+          const size_t w = targets[a];
+#pragma omp atomic
+          ++counts.per_vertex[w];
+          ++found_at_u;
+          ++a;
+          ++b;
+        }
+      }
+      if (found_at_u > 0) {
+#pragma omp atomic
+        counts.per_vertex[u] += found_at_u;
+      }
+      found_at_v += found_at_u;
+    }
+
+    if (found_at_v > 0) {
+#pragma omp atomic
+      counts.per_vertex[v] += found_at_v;
+    }
+    total += found_at_v;
+  }
+
+  counts.total = total;
+  return counts;
+}
+
+std::vector<double> clustering_coefficients(const Graph& graph, const TriangleCounts& counts) {
+  std::vector<double> coefficients(graph.order(), 0.0);
+  for (size_t v = 0; v < graph.order(); ++v) {
+    const size_t pairs = wedges(graph.degree(v));
+    if (pairs > 0) {
+      coefficients[v] = static_cast<double>(counts.per_vertex[v]) / static_cast<double>(pairs);
+    }
+  }
+  return coefficients;
+}
+
+double average_clustering(const Graph& graph, const TriangleCounts& counts) {
+  if (graph.order() == 0) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (double c : clustering_coefficients(graph, counts)) {
+    sum += c;
+  }
+  return sum / static_cast<double>(graph.order());
+}
+
+double transitivity(const Graph& graph, const TriangleCounts& counts) {
+  size_t pairs = 0;
+  for (size_t v = 0; v < graph.order(); ++v) {
+    pairs += wedges(graph.degree(v));
+  }
+  return pairs == 0 ? 0.0 : 3.0 * static_cast<double>(counts.total) / static_cast<double>(pairs);
+}
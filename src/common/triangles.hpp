@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Contagem de triângulos de um grafo.
+struct TriangleCounts {
+  size_t total = 0;                ///< Número de triângulos
+  std::vector<size_t> per_vertex;  ///< Triângulos que contêm cada vértice
+};
+
+/// @brief Conta triângulos orientando as arestas pela ordem de grau.
+///
+/// Cada aresta aponta para o extremo de maior (grau, id), o que limita o grau de saída a O(sqrt(m)).
+/// Cada triângulo é encontrado uma única vez no vértice de menor posto, intersectando listas de saída
+/// ordenadas. O laço sobre os vértices é paralelizado com OpenMP. Tempo O(m sqrt(m)).
+///
+/// @param graph Grafo.
+/// @return Total e contagem por vértice.
+[[nodiscard]] TriangleCounts count_triangles(const Graph& graph);
+
+/// @brief Coeficiente de agrupamento local t(v) / (d(v) (d(v) - 1) / 2) de cada vértice.
+/// @param graph Grafo.
+/// @param counts Resultado de count_triangles(graph).
+/// @return Coeficiente de cada vértice (0 para grau < 2).
+[[nodiscard]] std::vector<double> clustering_coefficients(const Graph& graph, const TriangleCounts& counts);
+
+/// @brief Média dos coeficientes locais sobre todos os vértices.
+/// @param graph Grafo.
+/// @param counts Resultado de count_triangles(graph).
+/// @return Valor entre 0.0 e 1.0.
+[[nodiscard]] double average_clustering(const Graph& graph, const TriangleCounts& counts);
+
+/// @brief Transitividade (agrupamento global): 3 * triângulos / caminhos de comprimento 2.
+/// @param graph Grafo.
+/// @param counts Resultado de count_triangles(graph).
+/// @return Valor entre 0.0 e 1.0.
+[[nodiscard]] double transitivity(const Graph& graph, const TriangleCounts& counts);
@@ -0,0 +1,104 @@
+#include "common/twins.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+/// Finalizador do SplitMix64: espalha bem ids consecutivos.
+constexpr uint64_t mix(uint64_t x) noexcept {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+}  // namespace
+
+uint64_t neighborhood_fingerprint(const Graph& graph, size_t v, TwinType type) {
+  uint64_t hash = type == TwinType::TRUE_TWINS ? mix(v) : 0;
+  for (size_t u : graph.neighbors_span(v)) {
+    hash += mix(u);
+  }
+  return hash;
+}
+
+std::vector<std::vector<size_t>> twin_classes(const Graph& graph, TwinType type,
+                                              std::span<const uint8_t> candidates) {
+  const size_t n = graph.order();
+  auto is_candidate = [&](size_t v) {
+    return (candidates.empty() || candidates[v] != 0) && graph.degree(v) > 0;
+  };
+
+  std::vector<uint64_t> fingerprint(n, 0);
+  const auto count = static_cast<int64_t>(n);
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int64_t i = 0; i < count; ++i) {
+    const auto v = static_cast<size_t>(i);
+    if (is_candidate(v)) {
+      fingerprint[v] = neighborhood_fingerprint(graph, v, type);
+    }
+  }
+
+  std::vector<size_t> order;
+  order.reserve(n);
+  for (size_t v = 0; v < n; ++v) {
+    if (is_candidate(v)) {
+      order.push_back(v);
+    }
+  }
+  auto key = [&](size_t v) { return std::pair{graph.degree(v), fingerprint[v]}; };
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    const auto ka = key(a);
+    const auto kb = key(b);
+    return ka != kb ? ka < kb : a < b;
+  });
+
+  // Confirma cada grupo marcando a vizinhança de um representante.
+  std::vector<std::vector<size_t>> classes;
+  std::vector<size_t> stamp(n, 0);
+  size_t current_stamp = 0;
+  std::vector<size_t> pending;
+  std::vector<size_t> rest;
+
+  for (size_t i = 0; i < order.size();) {
+    size_t j = i + 1;
+    while (j < order.size() && key(order[j]) == key(order[i])) {
+      ++j;
+    }
+
+    pending.assign(order.begin() + static_cast<std::ptrdiff_t>(i), order.begin() + static_cast<std::ptrdiff_t>(j));
+    while (pending.size() > 1) {
+      const size_t representative = pending.front();
+      ++current_stamp;
+      for (size_t u : graph.neighbors_span(representative)) {
+        stamp[u] = current_stamp;
+      }
+      if (type == TwinType::TRUE_TWINS) {
+        stamp[representative] = current_stamp;
+      }
+
+      std::vector<size_t> twins{representative};
+      rest.clear();
+      for (size_t k = 1; k < pending.size(); ++k) {
+        const size_t v = pending[k];
+        bool same = type == TwinType::FALSE_TWINS || stamp[v] == current_stamp;
+        for (size_t u : graph.neighbors_span(v)) {
+          if (!same) {
+            break;
+          }
+          same = stamp[u] == current_stamp;
+        }
+        (same ? twins : rest).push_back(v);
+      }
+
+      if (twins.size() > 1) {
+        classes.push_back(std::move(twins));
+      }
+      pending.swap(rest);
+    }
+    i = j;
+  }
+
+  return classes;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Tipo de gêmeos procurados.
+enum class TwinType {
+  FALSE_TWINS,  ///< Mesma vizinhança aberta: N(u) = N(v) (u e v não adjacentes)
+  TRUE_TWINS,   ///< Mesma vizinhança fechada: N[u] = N[v] (u e v adjacentes)
+};
+
+/// @brief Impressão digital de uma vizinhança, independente da ordem dos vizinhos.
+///
+/// Soma de um embaralhamento (finalizador do SplitMix64) de cada vizinho, o que equivale a um hash da
+/// lista ordenada sem precisar ordená-la. Na variante TRUE_TWINS o próprio vértice entra na soma.
+///
+/// @param graph Grafo.
+/// @param v Vértice.
+/// @param type Variante da vizinhança (aberta ou fechada).
+/// @return Impressão digital de N(v) ou N[v].
+[[nodiscard]] uint64_t neighborhood_fingerprint(const Graph& graph, size_t v, TwinType type);
+
+/// @brief Agrupa vértices gêmeos em tempo quase linear.
+///
+/// Os vértices são ordenados por (grau, impressão digital) e cada grupo com a mesma chave é confirmado
+/// comparando as vizinhanças com um vetor de marcas, então colisões de hash nunca produzem classes
+/// erradas. As impressões digitais são calculadas em paralelo com OpenMP.
+///
+/// @param graph Grafo.
+/// @param type Variante de gêmeos.
+/// @param candidates candidates[v] != 0 se v pode participar (vazio: todos os vértices).
+/// @return Classes com pelo menos dois vértices, cada uma em ordem crescente.
+/// @warning Vértices isolados são ignorados (seriam todos gêmeos falsos entre si).
+[[nodiscard]] std::vector<std::vector<size_t>> twin_classes(const Graph& graph, TwinType type,
+                                                            std::span<const uint8_t> candidates = {});
@@ -0,0 +1,97 @@
+#include "common/two_hop.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+/// Percorre N2[v] chamando visit uma vez por vértice; stamp[u] == mark indica u já visitado.
+template <typename Visit>
+void visit_two_hop(const Graph& graph, size_t v, std::vector<size_t>& stamp, size_t mark, Visit visit) {
+  auto touch = [&](size_t u) {
+    if (stamp[u] != mark) {
+      stamp[u] = mark;
+      visit(u);
+    }
+  };
+  touch(v);
+  for (size_t u : graph.neighbors_span(v)) {
+    touch(u);
+    for (size_t w : graph.neighbors_span(u)) {
+      touch(w);
+    }
+  }
+}
+
+}  // namespace
+
+void closed_two_hop_neighborhood(const Graph& graph, size_t v, std::vector<size_t>& out) {
+  if (v >= graph.order()) {
+    throw std::out_of_range("closed_two_hop_neighborhood: vértice inválido");
+  }
+  out.assign(1, v);
+  for (size_t u : graph.neighbors_span(v)) {
+    out.push_back(u);
+    out.insert(out.end(), graph.neighbors_span(u).begin(), graph.neighbors_span(u).end());
+  }
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+TwoHopNeighborhoods::TwoHopNeighborhoods(const Graph& graph, size_t memory_limit) : graph_(graph) {
+  const size_t n = graph.order();
+  const auto count = static_cast<int64_t>(n);
+  std::vector<size_t> sizes(n, 0);
+
+#pragma omp parallel
+  {
+    std::vector<size_t> stamp(n, 0);
+#pragma omp for schedule(dynamic, 256)
+    for (int64_t i = 0; i < count; ++i) {
+      const auto v = static_cast<size_t>(i);
+      visit_two_hop(graph, v, stamp, v + 1, [&](size_t) { ++sizes[v]; });
+    }
+  }
+
+  // Maior prefixo de vértices cujas listas e offsets cabem no limite
+  const size_t capacity = memory_limit / sizeof(size_t);
+  size_t used = 1;  // offsets_[0]
+  size_t total = 0;
+  while (num_stored_ < n && used + sizes[num_stored_] + 1 <= capacity) {
+    used += sizes[num_stored_] + 1;
+    total += sizes[num_stored_];
+    ++num_stored_;
+  }
+  if (num_stored_ == 0) {
+    return;
+  }
+
+  offsets_.resize(num_stored_ + 1);
+  offsets_[0] = 0;
+  for (size_t v = 0; v < num_stored_; ++v) {
+    offsets_[v + 1] = offsets_[v] + sizes[v];
+  }
+  vertices_.resize(total);
+
+  const auto stored = static_cast<int64_t>(num_stored_);
+#pragma omp parallel
+  {
+    std::vector<size_t> stamp(n, 0);
+#pragma omp for schedule(dynamic, 256)
+    for (int64_t i = 0; i < stored; ++i) {
+      const auto v = static_cast<size_t>(i);
+      size_t next = offsets_[v];
+      visit_two_hop(graph, v, stamp, v + 1, [&](size_t u) { vertices_[next++] = u; });
+      std::sort(vertices_.begin() + static_cast<std::ptrdiff_t>(offsets_[v]),
+                vertices_.begin() + static_cast<std::ptrdiff_t>(next));
+    }
+  }
+}
+
+std::span<const size_t> TwoHopNeighborhoods::closed(size_t v, std::vector<size_t>& buffer) const {
+  if (is_stored(v)) {
+    return {vertices_.data() + offsets_[v], offsets_[v + 1] - offsets_[v]};
+  }
+  closed_two_hop_neighborhood(graph_, v, buffer);
+  return buffer;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Memória padrão reservada para as vizinhanças de 2 saltos (256 MiB).
+inline constexpr size_t DEFAULT_TWO_HOP_MEMORY_LIMIT = size_t{256} << 20;
+
+/// @brief Vizinhanças fechadas de 2 saltos N2[v] = {v} ∪ N(v) ∪ N(N(v)) em formato CSR.
+///
+/// São os vértices afetados quando o rótulo de v muda: v, os vizinhos cuja soma recebida muda e os
+/// vizinhos deles, cuja viabilidade precisa ser reverificada. As listas são ordenadas e sem repetição.
+///
+/// A construção calcula os tamanhos em paralelo e guarda, em ordem crescente de vértice, as listas que
+/// cabem no limite de memória; as demais são calculadas sob demanda em um buffer do chamador.
+///
+/// @warning Guarda uma referência ao grafo: reconstrua o índice depois de modificá-lo.
+class TwoHopNeighborhoods {
+ private:
+  const Graph& graph_;
+  std::vector<size_t> offsets_;  ///< Lista de v em vertices_[offsets_[v], offsets_[v + 1])
+  std::vector<size_t> vertices_;
+  size_t num_stored_ = 0;        ///< Vértices 0..num_stored_-1 têm a lista armazenada
+
+ public:
+  /// @brief Pré-calcula as vizinhanças que cabem em memory_limit bytes.
+  /// @param graph Grafo.
+  /// @param memory_limit Máximo de bytes para as listas (0: nada é armazenado).
+  explicit TwoHopNeighborhoods(const Graph& graph, size_t memory_limit = DEFAULT_TWO_HOP_MEMORY_LIMIT);
+
+  /// @brief Indica se a lista de v foi pré-calculada.
+  [[nodiscard]] bool is_stored(size_t v) const noexcept { return v < num_stored_; }
+
+  /// @brief Número de vértices com a lista pré-calculada.
+  [[nodiscard]] size_t num_stored() const noexcept { return num_stored_; }
+
+  /// @brief Memória ocupada pelas listas armazenadas, em bytes.
+  [[nodiscard]] size_t memory_usage() const noexcept {
+    return (offsets_.size() + vertices_.size()) * sizeof(size_t);
+  }
+
+  /// @brief Obtém N2[v].
+  ///
+  /// Seguro para chamadas concorrentes desde que cada thread use o próprio buffer.
+  ///
+  /// @param v Vértice.
+  /// @param buffer Usado apenas se a lista de v não estiver armazenada.
+  /// @return Span ordenado, válido até a próxima modificação de buffer.
+  /// @throws std::out_of_range Se v for inválido.
+  [[nodiscard]] std::span<const size_t> closed(size_t v, std::vector<size_t>& buffer) const;
+};
+
+/// @brief Calcula N2[v] ordenada e sem repetição.
+/// @param graph Grafo.
+/// @param v Vértice.
+/// @param out Recebe a lista (o conteúdo anterior é descartado).
+/// @throws std::out_of_range Se v for inválido.
+void closed_two_hop_neighborhood(const Graph& graph, size_t v, std::vector<size_t>& out);
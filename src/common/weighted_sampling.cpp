@@ -0,0 +1,126 @@
+#include "common/weighted_sampling.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numeric>
+#include <string>
+
+namespace {
+
+void check_weight(double weight, const char* where) {
+  if (!std::isfinite(weight) || weight < 0.0) {
+    throw std::invalid_argument(std::string(where) + ": peso negativo ou não finito");
+  }
+}
+
+}  // namespace
+
+AliasTable::AliasTable(std::span<const double> weights) : columns_(weights.size()) {
+  const size_t n = weights.size();
+  if (n == 0) {
+    throw std::invalid_argument("AliasTable: sem pesos");
+  }
+  for (double weight : weights) {
+    check_weight(weight, "AliasTable");
+    total_weight_ += weight;
+  }
+  if (!(total_weight_ > 0.0)) {
+    throw std::invalid_argument("AliasTable: soma dos pesos é zero");
+  }
+
+  // Vose: colunas abaixo da média (small) são completadas por colunas acima (large)
+  std::vector<double> scaled(n);
+  std::vector<size_t> small;
+  std::vector<size_t> large;
+  for (size_t i = 0; i < n; ++i) {
+    scaled[i] = weights[i] * static_cast<double>(n) / total_weight_;
+    (scaled[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  auto to_threshold = [](double probability) {
+    return probability >= 1.0 ? UINT64_MAX : static_cast<uint64_t>(probability * 0x1.0p64);
+  };
+  while (!small.empty() && !large.empty()) {
+    const size_t s = small.back();
+    const size_t l = large.back();
+    small.pop_back();
+    columns_[s] = {to_threshold(scaled[s]), l};
+    scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+    if (scaled[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // Sobras (só por arredondamento entre as pequenas) ficam com a própria coluna
+  for (const auto* rest : {&small, &large}) {
+    for (size_t i : *rest) {
+      columns_[i] = {UINT64_MAX, i};
+    }
+  }
+}
+
+DynamicWeightedSampler::DynamicWeightedSampler(size_t n)
+    : weights_(n, 0.0), tree_(n + 1, 0.0), top_bit_(n == 0 ? 0 : std::bit_floor(n)) {}
+
+DynamicWeightedSampler::DynamicWeightedSampler(std::span<const double> weights)
+    : weights_(weights.begin(), weights.end()), tree_(weights.size() + 1, 0.0) {
+  for (double weight : weights_) {
+    check_weight(weight, "DynamicWeightedSampler");
+  }
+  top_bit_ = weights_.empty() ? 0 : std::bit_floor(weights_.size());
+  rebuild();
+}
+
+void DynamicWeightedSampler::rebuild() {
+  const size_t n = weights_.size();
+  std::copy(weights_.begin(), weights_.end(), tree_.begin() + 1);
+  for (size_t i = 1; i <= n; ++i) {
+    const size_t parent = i + (i & (~i + 1));
+    if (parent <= n) {
+      tree_[parent] += tree_[i];
+    }
+  }
+  total_weight_ = std::accumulate(weights_.begin(), weights_.end(), 0.0);
+  nonzero_ = static_cast<size_t>(std::count_if(weights_.begin(), weights_.end(), [](double w) { return w > 0.0; }));
+  updates_ = 0;
+}
+
+void DynamicWeightedSampler::set_weight(size_t i, double weight) {
+  if (i >= weights_.size()) {
+    throw std::out_of_range("DynamicWeightedSampler::set_weight: índice inválido");
+  }
+  check_weight(weight, "DynamicWeightedSampler::set_weight");
+
+  const double delta = weight - weights_[i];
+  nonzero_ += static_cast<size_t>(weight > 0.0) - static_cast<size_t>(weights_[i] > 0.0);
+  weights_[i] = weight;
+  if (++updates_ >= weights_.size()) {
+    rebuild();
+    return;
+  }
+  for (size_t k = i + 1; k < tree_.size(); k += k & (~k + 1)) {
+    tree_[k] += delta;
+  }
+  total_weight_ += delta;
+}
+
+size_t DynamicWeightedSampler::find(double target) const noexcept {
+  // Menor índice cujo prefixo de pesos passa de target
+  size_t position = 0;
+  for (size_t step = top_bit_; step > 0; step >>= 1) {
+    if (position + step < tree_.size() && tree_[position + step] <= target) {
+      position += step;
+      target -= tree_[position];
+    }
+  }
+  return position;
+}
+
+size_t DynamicWeightedSampler::last_nonzero() const noexcept {
+  size_t i = weights_.size();
+  while (i > 0 && !(weights_[i - 1] > 0.0)) {
+    --i;
+  }
+  return i - 1;
+}
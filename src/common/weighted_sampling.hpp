@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "common/random.hpp"
+
+/**
+ * @class AliasTable
+ * @brief Amostragem ponderada em O(1) pelo método de alias (Walker, com a
+ * construção estável de Vose)
+ *
+ * Cada índice i tem uma coluna com um limiar e um alias: sorteia-se
+ * uma coluna uniforme e, com a probabilidade do limiar, fica-se com ela; senão,
+ * com o alias. A construção custa O(n) e cada amostra usa um único número de
+ * 64 bits: a metade alta do produto por n escolhe a coluna e a metade baixa é
+ * comparada ao limiar. Limiar e alias ficam lado a lado, então uma amostra
+ * toca uma única linha de cache. Indicada para pesos fixos, como a roleta de
+ * uma geração inteira ou a escolha de vértices proporcional ao grau.
+ */
+class AliasTable {
+ private:
+  struct Column {
+    uint64_t threshold;  ///< Probabilidade de ficar com a coluna, em unidades de 2^-64
+    size_t alias;        ///< Índice usado quando a coluna é rejeitada
+  };
+
+  std::vector<Column> columns_;
+  double total_weight_ = 0.0;
+
+ public:
+  /**
+   * @brief Constrói a tabela
+   * @param weights Pesos não negativos (ao menos um positivo)
+   * @throws std::invalid_argument Se weights for vazio, tiver peso negativo ou
+   * não finito, ou soma zero.
+   */
+  explicit AliasTable(std::span<const double> weights);
+
+  /**
+   * @brief Sorteia um índice com probabilidade proporcional ao seu peso
+   * @param stream Fluxo de números aleatórios
+   * @return Índice em [0, size())
+   */
+  template <typename Engine>
+  [[nodiscard]] size_t sample(RNGStream<Engine>& stream) const {
+    const auto product = static_cast<unsigned __int128>(stream.next_u64()) * columns_.size();
+    const auto i = static_cast<size_t>(product >> 64);
+    return static_cast<uint64_t>(product) < columns_[i].threshold ? i : columns_[i].alias;
+  }
+
+  /**
+   * @brief Sorteia um índice no fluxo da thread thread_id
+   * @param rng Gerador
+   * @param thread_id ID da thread chamadora (0 a num_threads-1)
+   * @return Índice em [0, size())
+   * @throws std::out_of_range Se thread_id for inválido.
+   */
+  template <typename Engine>
+  [[nodiscard]] size_t sample(BasicRNG<Engine>& rng, int thread_id) const {
+    return sample(rng.stream(thread_id));
+  }
+
+  /// @brief Número de índices
+  [[nodiscard]] size_t size() const noexcept { return columns_.size(); }
+
+  /// @brief Soma dos pesos
+  [[nodiscard]] double total_weight() const noexcept { return total_weight_; }
+};
+
+/**
+ * @class DynamicWeightedSampler
+ * @brief Amostragem ponderada com pesos que mudam a cada iteração
+ *
+ * Guarda os pesos em uma árvore de Fenwick: alterar um peso e sortear um
+ * índice custam O(log n), ao contrário de reconstruir uma AliasTable (O(n))
+ * ou percorrer os pesos acumulados. Indicada para seleção adaptativa de
+ * operadores e roletas com aptidões atualizadas incrementalmente.
+ *
+ * Para limitar o erro de arredondamento acumulado, a árvore é reconstruída a
+ * partir dos pesos exatos depois de size() alterações (custo O(1) amortizado).
+ */
+class DynamicWeightedSampler {
+ private:
+  std::vector<double> weights_;  ///< Pesos atuais
+  std::vector<double> tree_;     ///< Árvore de Fenwick (base 1) sobre weights_
+  double total_weight_ = 0.0;
+  size_t nonzero_ = 0;  ///< Pesos positivos (contagem exata, ao contrário de total_weight_)
+  size_t updates_ = 0;  ///< Alterações desde a última reconstrução
+  size_t top_bit_ = 0;  ///< Maior potência de 2 <= size()
+
+  /// Sorteios pela árvore antes de recorrer a last_nonzero()
+  static constexpr int MAX_SAMPLE_ATTEMPTS = 4;
+
+  void rebuild();
+  [[nodiscard]] size_t find(double target) const noexcept;
+  [[nodiscard]] size_t last_nonzero() const noexcept;
+
+ public:
+  /**
+   * @brief Constrói o amostrador com todos os pesos nulos
+   * @param n Número de índices
+   */
+  explicit DynamicWeightedSampler(size_t n);
+
+  /**
+   * @brief Constrói o amostrador com pesos iniciais em O(n)
+   * @param weights Pesos não negativos
+   * @throws std::invalid_argument Se algum peso for negativo ou não finito.
+   */
+  explicit DynamicWeightedSampler(std::span<const double> weights);
+
+  /**
+   * @brief Altera o peso de um índice em O(log n)
+   * @param i Índice
+   * @param weight Novo peso
+   * @throws std::out_of_range Se i for inválido.
+   * @throws std::invalid_argument Se weight for negativo ou não finito.
+   */
+  void set_weight(size_t i, double weight);
+
+  /// @brief Peso atual de i (sem verificação de limites)
+  [[nodiscard]] double weight(size_t i) const noexcept { return weights_[i]; }
+
+  /// @brief Número de índices
+  [[nodiscard]] size_t size() const noexcept { return weights_.size(); }
+
+  /// @brief Soma dos pesos
+  [[nodiscard]] double total_weight() const noexcept { return total_weight_; }
+
+  /**
+   * @brief Sorteia um índice com probabilidade proporcional ao seu peso
+   * @param stream Fluxo de números aleatórios
+   * @return Índice com peso positivo
+   * @throws std::logic_error Se todos os pesos forem nulos.
+   */
+  template <typename Engine>
+  [[nodiscard]] size_t sample(RNGStream<Engine>& stream) const;
+
+  /**
+   * @brief Sorteia um índice no fluxo da thread thread_id
+   * @param rng Gerador
+   * @param thread_id ID da thread chamadora (0 a num_threads-1)
+   * @return Índice com peso positivo
+   * @throws std::out_of_range Se thread_id for inválido.
+   * @throws std::logic_error Se todos os pesos forem nulos.
+   */
+  template <typename Engine>
+  [[nodiscard]] size_t sample(BasicRNG<Engine>& rng, int thread_id) const {
+    return sample(rng.stream(thread_id));
+  }
+};
+
+template <typename Engine>
+size_t DynamicWeightedSampler::sample(RNGStream<Engine>& stream) const {
+  if (nonzero_ == 0) {
+    throw std::logic_error("DynamicWeightedSampler::sample: todos os pesos são nulos");
+  }
+  // O arredondamento pode levar a um índice de peso nulo; nesse caso sorteia de novo e, se persistir,
+  // fica com o último peso positivo (o erro acumula no fim dos prefixos)
+  for (int attempt = 0; attempt < MAX_SAMPLE_ATTEMPTS && total_weight_ > 0.0; ++attempt) {
+    const size_t i = find(stream.uniform_real(0.0, total_weight_));
+    if (i < weights_.size() && weights_[i] > 0.0) {
+      return i;
+    }
+  }
+  return last_nonzero();
+}
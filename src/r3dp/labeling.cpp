@@ -0,0 +1,34 @@
+#include "r3dp/labeling.hpp"
+
+#include <numeric>
+
+bool is_r3df(const Graph& graph, std::span<const uint8_t> labels, std::span<const uint8_t> satisfied) {
+  if (labels.size() != graph.order()) {
+    return false;
+  }
+
+  for (size_t v = 0; v < graph.order(); ++v) {
+    if (labels[v] > MAX_LABEL) {
+      return false;
+    }
+
+    const uint8_t demand = vertex_demand(satisfied, v, labels[v]);
+    if (demand == 0) {
+      continue;
+    }
+
+    size_t received = 0;
+    for (size_t u : graph.neighbors_span(v)) {
+      received += labels[u];
+    }
+    if (received < demand) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+size_t labeling_weight(std::span<const uint8_t> labels) noexcept {
+  return std::accumulate(labels.begin(), labels.end(), size_t{0});
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+
+/// @brief Rotulação f: V -> {0, 1, 2, 3} de um grafo, indexada pelo vértice.
+using Labeling = std::vector<uint8_t>;
+
+/// @brief Maior rótulo permitido em uma função Roman {3}-dominante.
+inline constexpr uint8_t MAX_LABEL = 3;
+
+/// @brief Soma mínima que um vértice com rótulo f precisa receber da vizinhança aberta.
+///
+/// Uma função Roman {3}-dominante exige f(N(v)) >= 3 quando f(v) = 0 e f(N(v)) >= 2 quando f(v) = 1.
+/// Vértices com rótulo 2 ou 3 não têm exigência.
+///
+/// @param label Rótulo do vértice.
+/// @return Demanda do vértice sobre a vizinhança aberta.
+[[nodiscard]] constexpr uint8_t label_demand(uint8_t label) noexcept {
+  return label >= 2 ? 0 : static_cast<uint8_t>(MAX_LABEL - label);
+}
+
+/// @brief Demanda de v considerando vértices já atendidos.
+///
+/// Instâncias reduzidas marcam como atendidos os vértices vizinhos de um vértice removido com rótulo 3;
+/// eles não têm demanda, mas continuam podendo atender os vizinhos.
+///
+/// @param satisfied satisfied[v] != 0 se v já está atendido (vazio: nenhum está).
+/// @param v Vértice.
+/// @param label Rótulo de v.
+/// @return Demanda de v sobre a vizinhança aberta.
+[[nodiscard]] constexpr uint8_t vertex_demand(std::span<const uint8_t> satisfied, size_t v, uint8_t label) noexcept {
+  return !satisfied.empty() && satisfied[v] != 0 ? 0 : label_demand(label);
+}
+
+/// @brief Verifica se a rotulação é uma função Roman {3}-dominante do grafo.
+/// @param graph Grafo.
+/// @param labels Rótulo de cada vértice.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @return true se todo vértice tem sua demanda atendida, false caso contrário.
+/// @warning Retorna false se o tamanho de labels diferir de graph.order() ou se algum rótulo for maior que 3.
+[[nodiscard]] bool is_r3df(const Graph& graph, std::span<const uint8_t> labels,
+                           std::span<const uint8_t> satisfied = {});
+
+/// @brief Calcula o peso w(f) = soma dos rótulos.
+/// @param labels Rótulo de cada vértice.
+/// @return Peso da rotulação.
+[[nodiscard]] size_t labeling_weight(std::span<const uint8_t> labels) noexcept;
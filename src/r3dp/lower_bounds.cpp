@@ -0,0 +1,236 @@
+#include "r3dp/lower_bounds.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+/// Tolerância para arredondar limitantes fracionários para cima.
+constexpr double EPSILON = 1e-7;
+
+/// Passo inicial (fator de Polyak) do subgradiente e iterações sem melhora antes de reduzi-lo.
+constexpr double INITIAL_STEP_FACTOR = 2.0;
+constexpr double MIN_STEP_FACTOR = 1e-3;
+constexpr size_t STALL_LIMIT = 10;
+
+bool is_satisfied(std::span<const uint8_t> satisfied, size_t v) { return !satisfied.empty() && satisfied[v] != 0; }
+
+size_t round_up(double bound) { return bound <= 0.0 ? 0 : static_cast<size_t>(std::ceil(bound - EPSILON)); }
+
+/// Vértices não atendidos em ordem crescente de grau (empates pelo id).
+std::vector<size_t> demand_order(const Graph& graph, std::span<const uint8_t> satisfied) {
+  std::vector<size_t> order;
+  order.reserve(graph.order());
+  for (size_t v = 0; v < graph.order(); ++v) {
+    if (!is_satisfied(satisfied, v)) {
+      order.push_back(v);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return graph.degree(a) < graph.degree(b); });
+  return order;
+}
+
+/// Multiplicadores do dual de grau: λ_v = 2 / (2d + 3), d o maior grau em N[v].
+std::vector<double> degree_dual(const Graph& graph, std::span<const uint8_t> satisfied) {
+  std::vector<double> lambda(graph.order(), 0.0);
+  for (size_t v = 0; v < graph.order(); ++v) {
+    if (is_satisfied(satisfied, v)) {
+      continue;
+    }
+    size_t d = graph.degree(v);
+    for (size_t u : graph.neighbors_span(v)) {
+      d = std::max(d, graph.degree(u));
+    }
+    lambda[v] = 2.0 / static_cast<double>(2 * d + 3);
+  }
+  return lambda;
+}
+
+/// Multiplicadores do 2-empacotamento guloso: λ_v = 2/3 nos vértices escolhidos.
+std::vector<double> packing_dual(const Graph& graph, std::span<const uint8_t> satisfied) {
+  std::vector<double> lambda(graph.order(), 0.0);
+  std::vector<uint8_t> covered(graph.order(), 0);  // Pertence a N[p] para algum p escolhido
+
+  for (size_t v : demand_order(graph, satisfied)) {
+    // v está a distância <= 2 de p escolhido sse N[v] intersecta N[p]
+    bool free = covered[v] == 0;
+    for (size_t u : graph.neighbors_span(v)) {
+      free = free && covered[u] == 0;
+    }
+    if (!free) {
+      continue;
+    }
+    lambda[v] = 2.0 / 3.0;
+    covered[v] = 1;
+    for (size_t u : graph.neighbors_span(v)) {
+      covered[u] = 1;
+    }
+  }
+  return lambda;
+}
+
+/// Dual guloso: aumenta cada λ_v até esgotar a folga das restrições duais de N[v].
+///
+/// As restrições duais de u são 3λ_u + 2Λ_u <= 2 (rótulo 2) e 3λ_u + 3Λ_u <= 3 (rótulo 3), com
+/// Λ_u = soma de λ sobre N(u).
+std::vector<double> greedy_dual(const Graph& graph, std::span<const uint8_t> satisfied) {
+  std::vector<double> lambda(graph.order(), 0.0);
+  std::vector<double> slack_two(graph.order(), 2.0);
+  std::vector<double> slack_three(graph.order(), 3.0);
+
+  for (size_t v : demand_order(graph, satisfied)) {
+    double delta = std::min(slack_two[v], slack_three[v]) / 3.0;
+    for (size_t u : graph.neighbors_span(v)) {
+      delta = std::min({delta, slack_two[u] / 2.0, slack_three[u] / 3.0});
+    }
+    if (delta <= 0.0) {
+      continue;
+    }
+    lambda[v] = delta;
+    slack_two[v] -= 3.0 * delta;
+    slack_three[v] -= 3.0 * delta;
+    for (size_t u : graph.neighbors_span(v)) {
+      slack_two[u] -= 2.0 * delta;
+      slack_three[u] -= 3.0 * delta;
+    }
+  }
+  return lambda;
+}
+
+/// @brief Dual lagrangiano da relaxação linear, avaliado em paralelo.
+///
+/// L(λ) = 3 sum λ_v + sum_v min(0, 2 - 3λ_v - 2Λ_v, 3 - 3λ_v - 3Λ_v); o mínimo escolhe o rótulo
+/// (0, 2 ou 3) de cada vértice no subproblema, e o subgradiente é a folga das restrições primais.
+class LagrangianDual {
+ private:
+  const Graph& graph_;
+  std::span<const uint8_t> satisfied_;
+  std::vector<uint8_t> choice_;  ///< Rótulo escolhido no subproblema
+  std::vector<double> gradient_;
+
+ public:
+  LagrangianDual(const Graph& graph, std::span<const uint8_t> satisfied)
+      : graph_(graph), satisfied_(satisfied), choice_(graph.order(), 0), gradient_(graph.order(), 0.0) {}
+
+  [[nodiscard]] const std::vector<double>& gradient() const noexcept { return gradient_; }
+
+  /// Avalia L(λ) e preenche o subgradiente.
+  double evaluate(const std::vector<double>& lambda) {
+    const auto count = static_cast<int64_t>(graph_.order());
+    double value = 0.0;
+
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : value)
+    for (int64_t i = 0; i < count; ++i) {
+      const auto v = static_cast<size_t>(i);
+      double received = 0.0;
+      for (size_t u : graph_.neighbors_span(v)) {
+        received += lambda[u];
+      }
+      const double cost_two = 2.0 - 3.0 * lambda[v] - 2.0 * received;
+      const double cost_three = 3.0 - 3.0 * lambda[v] - 3.0 * received;
+      const double best = std::min({0.0, cost_two, cost_three});
+      choice_[v] = best == 0.0 ? 0 : (best == cost_three ? 3 : 2);
+      value += 3.0 * lambda[v] + best;
+    }
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int64_t i = 0; i < count; ++i) {
+      const auto v = static_cast<size_t>(i);
+      if (is_satisfied(satisfied_, v)) {
+        gradient_[v] = 0.0;
+        continue;
+      }
+      double coverage = choice_[v] == 0 ? 0.0 : 3.0;
+      for (size_t u : graph_.neighbors_span(v)) {
+        coverage += choice_[u];
+      }
+      gradient_[v] = 3.0 - coverage;
+    }
+
+    return value;
+  }
+};
+
+double dual_value(const std::vector<double>& lambda) {
+  return 3.0 * std::accumulate(lambda.begin(), lambda.end(), 0.0);
+}
+
+}  // namespace
+
+size_t degree_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied) {
+  return round_up(dual_value(degree_dual(graph, satisfied)));
+}
+
+size_t packing_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied) {
+  return round_up(dual_value(packing_dual(graph, satisfied)));
+}
+
+size_t lp_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied, size_t upper_bound,
+                      size_t iterations) {
+  const size_t n = graph.order();
+  if (upper_bound == 0) {
+    // Rótulo 2 em todo vértice não atendido é sempre uma solução
+    for (size_t v = 0; v < n; ++v) {
+      upper_bound += is_satisfied(satisfied, v) ? 0 : 2;
+    }
+  }
+
+  // Ponto de partida: o melhor dos duais viáveis (para eles L(λ) = 3 sum λ)
+  std::vector<double> lambda = greedy_dual(graph, satisfied);
+  double best = dual_value(lambda);
+  for (auto&& candidate : {degree_dual(graph, satisfied), packing_dual(graph, satisfied)}) {
+    const double value = dual_value(candidate);
+    if (value > best) {
+      best = value;
+      lambda = candidate;
+    }
+  }
+
+  LagrangianDual dual(graph, satisfied);
+  double step_factor = INITIAL_STEP_FACTOR;
+  size_t stall = 0;
+
+  for (size_t it = 0; it < iterations && round_up(best) < upper_bound; ++it) {
+    const double value = dual.evaluate(lambda);
+    if (value > best + EPSILON) {
+      best = value;
+      stall = 0;
+    } else if (++stall >= STALL_LIMIT) {
+      step_factor /= 2.0;
+      stall = 0;
+      if (step_factor < MIN_STEP_FACTOR) {
+        break;
+      }
+    }
+
+    // Norma do subgradiente projetado (multiplicadores nulos não descem)
+    const std::vector<double>& gradient = dual.gradient();
+    double norm = 0.0;
+    for (size_t v = 0; v < n; ++v) {
+      if (lambda[v] > 0.0 || gradient[v] > 0.0) {
+        norm += gradient[v] * gradient[v];
+      }
+    }
+    if (norm == 0.0) {
+      break;  // λ é ótimo para o dual
+    }
+
+    const double step = step_factor * (static_cast<double>(upper_bound) - value) / norm;
+    for (size_t v = 0; v < n; ++v) {
+      lambda[v] = std::max(0.0, lambda[v] + step * gradient[v]);
+    }
+  }
+
+  return std::min(round_up(best), upper_bound);
+}
+
+LowerBounds compute_lower_bounds(const Graph& graph, std::span<const uint8_t> satisfied, size_t upper_bound,
+                                 size_t iterations) {
+  LowerBounds bounds;
+  bounds.degree = degree_lower_bound(graph, satisfied);
+  bounds.packing = packing_lower_bound(graph, satisfied);
+  bounds.lp = lp_lower_bound(graph, satisfied, upper_bound, iterations);
+  return bounds;
+}
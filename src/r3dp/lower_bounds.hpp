@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "common/graph.hpp"
+
+/// @brief Número padrão de iterações do subgradiente em lp_lower_bound().
+inline constexpr size_t DEFAULT_SUBGRADIENT_ITERATIONS = 300;
+
+/// @brief Limitantes inferiores combinatórios para γR3(G).
+///
+/// Todos vêm de soluções do dual da relaxação linear
+///   min sum 2a_v + 3b_v  s.a.  3(a_v + b_v) + sum_{u in N(v)} (2a_u + 3b_u) >= 3,  a_v + b_v <= 1,
+/// onde a_v e b_v indicam os rótulos 2 e 3 (o rótulo 1 é dominado na relaxação). Vértices atendidos
+/// não têm restrição.
+struct LowerBounds {
+  size_t degree = 0;   ///< Dual local de grau: sum_v 6 / (2 max_{u in N[v]} deg(u) + 3)
+  size_t packing = 0;  ///< 2 |P| para um 2-empacotamento guloso P de vértices não atendidos
+  size_t lp = 0;       ///< Dual lagrangiano da relaxação linear melhorado por subgradiente
+
+  /// @brief Maior dos limitantes.
+  [[nodiscard]] constexpr size_t best() const noexcept {
+    return std::max({degree, packing, lp});
+  }
+};
+
+/// @brief Limitante baseado em graus, O(n + m).
+///
+/// Generaliza 6n / (2Δ + 3): cada vértice v contribui com 6 / (2d + 3), d o maior grau em N[v].
+///
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @return Limitante inferior para o peso de qualquer função Roman {3}-dominante.
+[[nodiscard]] size_t degree_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied = {});
+
+/// @brief Limitante por 2-empacotamento guloso, O(n log n + m).
+///
+/// Em um 2-empacotamento as vizinhanças fechadas são disjuntas e cada uma recebe peso pelo menos 2.
+/// Os vértices são escolhidos em ordem crescente de grau.
+///
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @return Limitante inferior para o peso de qualquer função Roman {3}-dominante.
+[[nodiscard]] size_t packing_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied = {});
+
+/// @brief Limitante da relaxação linear por dual lagrangiano e subgradiente, O(iterations * (n + m)).
+///
+/// Parte do melhor entre o dual guloso (cada multiplicador aumentado até esgotar a folga das restrições
+/// duais, em ordem crescente de grau), o dual de grau e o de empacotamento. Qualquer vetor de
+/// multiplicadores dá um limitante válido, então o resultado nunca piora com mais iterações. Os passos
+/// seguem a regra de Polyak e cada iteração é paralelizada com OpenMP.
+///
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @param upper_bound Peso de uma solução conhecida (0: usa 2 por vértice não atendido); o método para
+///                    assim que o limitante o alcança.
+/// @param iterations Máximo de iterações do subgradiente.
+/// @return Limitante inferior para o peso de qualquer função Roman {3}-dominante.
+[[nodiscard]] size_t lp_lower_bound(const Graph& graph, std::span<const uint8_t> satisfied = {},
+                                    size_t upper_bound = 0, size_t iterations = DEFAULT_SUBGRADIENT_ITERATIONS);
+
+/// @brief Calcula todos os limitantes.
+///
+/// Para um kernel de Reducer, somar report().weight_offset dá limitantes para o grafo original.
+///
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @param upper_bound Peso de uma solução conhecida (0: nenhuma).
+/// @param iterations Máximo de iterações do subgradiente.
+/// @return Os três limitantes.
+[[nodiscard]] LowerBounds compute_lower_bounds(const Graph& graph, std::span<const uint8_t> satisfied = {},
+                                               size_t upper_bound = 0,
+                                               size_t iterations = DEFAULT_SUBGRADIENT_ITERATIONS);
+
+/// @brief Gap relativo (upper - lower) / upper entre uma solução e um limitante.
+/// @param upper_bound Peso da solução.
+/// @param lower_bound Limitante inferior.
+/// @return Valor entre 0.0 (ótimo provado) e 1.0.
+[[nodiscard]] constexpr double optimality_gap(size_t upper_bound, size_t lower_bound) noexcept {
+  if (upper_bound == 0 || lower_bound >= upper_bound) {
+    return 0.0;
+  }
+  return static_cast<double>(upper_bound - lower_bound) / static_cast<double>(upper_bound);
+}
+
+/// @brief Indica se uma solução de peso upper_bound é comprovadamente ótima.
+[[nodiscard]] constexpr bool is_proven_optimal(size_t upper_bound, const LowerBounds& bounds) noexcept {
+  return bounds.best() >= upper_bound;
+}
@@ -0,0 +1,386 @@
+#include "r3dp/reduction.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "common/twins.hpp"
+
+namespace {
+
+constexpr size_t TRUE_TWINS_KEPT = 2;   ///< Dois gêmeos verdadeiros já forçam f(N[K]) >= 3
+constexpr size_t FALSE_TWINS_KEPT = 4;  ///< Com 4 gêmeos falsos a troca para f(N) >= 3 nunca piora
+constexpr size_t CHAIN_MIN_LENGTH = 10;
+constexpr size_t CHAIN_PERIOD = 3;         ///< Vértices removidos por encurtamento
+constexpr size_t CHAIN_PERIOD_WEIGHT = 3;  ///< Peso somado por encurtamento
+constexpr size_t NUM_LABELS = MAX_LABEL + 1;
+
+constexpr uint32_t INF = std::numeric_limits<uint32_t>::max() / 4;
+
+/// @brief Rotula otimamente uma cadeia x - path - y com os extremos x e y fixos.
+///
+/// O primeiro e o último vértice da cadeia precisam de rótulo pelo menos first_min e last_min, para
+/// que x e y continuem recebendo o que recebiam no grafo reduzido.
+void solve_chain(const std::vector<size_t>& path, uint8_t fx, uint8_t fy, uint8_t first_min, uint8_t last_min,
+                 Labeling& labels) {
+  // Estado (rótulo anterior, rótulo atual) na posição i; back guarda o rótulo de i - 2.
+  using Row = std::array<uint32_t, NUM_LABELS * NUM_LABELS>;
+  using BackRow = std::array<uint8_t, NUM_LABELS * NUM_LABELS>;
+  const size_t k = path.size();
+  std::vector<Row> cost(k);
+  std::vector<BackRow> back(k);
+  for (auto& row : cost) {
+    row.fill(INF);
+  }
+
+  for (uint8_t f = first_min; f < NUM_LABELS; ++f) {
+    cost[0][fx * NUM_LABELS + f] = f;
+  }
+
+  for (size_t i = 0; i + 1 < k; ++i) {
+    for (uint8_t prev = 0; prev < NUM_LABELS; ++prev) {
+      for (uint8_t cur = 0; cur < NUM_LABELS; ++cur) {
+        const uint32_t value = cost[i][prev * NUM_LABELS + cur];
+        if (value == INF) {
+          continue;
+        }
+        for (uint8_t next = 0; next < NUM_LABELS; ++next) {
+          if (prev + next < label_demand(cur)) {
+            continue;
+          }
+          const size_t state = cur * NUM_LABELS + next;
+          if (value + next < cost[i + 1][state]) {
+            cost[i + 1][state] = value + next;
+            back[i + 1][state] = prev;
+          }
+        }
+      }
+    }
+  }
+
+  uint32_t best = INF;
+  uint8_t prev = 0;
+  uint8_t cur = 0;
+  for (uint8_t p = 0; p < NUM_LABELS; ++p) {
+    for (uint8_t c = last_min; c < NUM_LABELS; ++c) {
+      if (p + fy >= label_demand(c) && cost[k - 1][p * NUM_LABELS + c] < best) {
+        best = cost[k - 1][p * NUM_LABELS + c];
+        prev = p;
+        cur = c;
+      }
+    }
+  }
+  if (best == INF) {
+    throw std::logic_error("Reducer::lift: cadeia sem rotulação compatível");
+  }
+
+  for (size_t i = k - 1; i > 0; --i) {
+    labels[path[i]] = cur;
+    const uint8_t before = back[i][prev * NUM_LABELS + cur];
+    cur = prev;
+    prev = before;
+  }
+  labels[path[0]] = cur;
+}
+
+}  // namespace
+
+double ReductionReport::vertex_reduction() const noexcept {
+  if (original_vertices == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(original_vertices - kernel_vertices) / static_cast<double>(original_vertices);
+}
+
+double ReductionReport::edge_reduction() const noexcept {
+  if (original_edges == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(original_edges - kernel_edges) / static_cast<double>(original_edges);
+}
+
+Reducer::Reducer(const Graph& graph)
+    : work_(graph),
+      alive_(graph.order(), 1),
+      satisfied_(graph.order(), 0),
+      queued_(graph.order(), 0) {
+  report_.original_vertices = graph.order();
+  report_.original_edges = graph.num_edges();
+}
+
+void Reducer::enqueue(size_t v) {
+  if (alive_[v] != 0 && queued_[v] == 0) {
+    queued_[v] = 1;
+    worklist_.push_back(v);
+  }
+}
+
+void Reducer::fix(size_t v, uint8_t label) {
+  trail_.emplace_back(FixedLabel{v, label});
+  report_.weight_offset += label;
+  remove_vertex(v);
+}
+
+void Reducer::remove_vertex(size_t v) {
+  const std::vector<size_t> neighbors = work_.neighbors(v);
+  for (size_t u : neighbors) {
+    work_.remove_edge(v, u);
+    enqueue(u);
+  }
+  alive_[v] = 0;
+}
+
+bool Reducer::reduce_vertex(size_t v) {
+  if (alive_[v] == 0) {
+    return false;
+  }
+
+  const size_t degree = work_.degree(v);
+  if (degree == 0) {
+    ++report_.isolated;
+    fix(v, satisfied_[v] != 0 ? 0 : 2);
+    return true;
+  }
+
+  if (satisfied_[v] != 0) {
+    if (degree == 1) {
+      ++report_.satisfied_leaves;
+      fix(v, 0);
+      return true;
+    }
+
+    // A aresta só serviria para atender um dos extremos, e ambos já estão atendidos.
+    bool removed = false;
+    const std::vector<size_t> neighbors = work_.neighbors(v);
+    for (size_t u : neighbors) {
+      if (satisfied_[u] != 0) {
+        work_.remove_edge(v, u);
+        enqueue(u);
+        ++report_.satisfied_edges;
+        removed = true;
+      }
+    }
+    if (removed) {
+      enqueue(v);
+      return true;
+    }
+  }
+
+  if (degree == 1 && reduce_support(work_.neighbors(v).front())) {
+    return true;
+  }
+  if (reduce_support(v)) {
+    return true;
+  }
+  return degree == 2 && satisfied_[v] == 0 && reduce_chain(v);
+}
+
+bool Reducer::reduce_support(size_t s) {
+  std::vector<size_t> leaves;
+  std::vector<size_t> others;
+  for (size_t u : work_.neighbors_span(s)) {
+    if (work_.degree(u) == 1 && satisfied_[u] == 0) {
+      leaves.push_back(u);
+    } else {
+      others.push_back(u);
+    }
+  }
+  if (leaves.size() < 2) {
+    return false;
+  }
+
+  // Com duas folhas, trocar os rótulos por s = 3 e folhas = 0 nunca piora a solução.
+  for (size_t u : others) {
+    satisfied_[u] = 1;
+  }
+  ++report_.supports;
+  fix(s, MAX_LABEL);
+  for (size_t leaf : leaves) {
+    fix(leaf, 0);
+  }
+  return true;
+}
+
+bool Reducer::reduce_chain(size_t v) {
+  auto is_inner = [this](size_t u) { return satisfied_[u] == 0 && work_.degree(u) == 2; };
+
+  // Caminha a partir de v até o primeiro vértice que não é interno da cadeia.
+  auto walk = [&](size_t next, std::vector<size_t>& out) {
+    size_t prev = v;
+    while (next != v && is_inner(next)) {
+      out.push_back(next);
+      const auto neighbors = work_.neighbors_span(next);
+      const size_t after = neighbors[0] == prev ? neighbors[1] : neighbors[0];
+      prev = next;
+      next = after;
+    }
+    return next;
+  };
+
+  const size_t first = work_.neighbors(v)[0];
+  const size_t second = work_.neighbors(v)[1];
+  std::vector<size_t> left;
+  std::vector<size_t> right;
+  const size_t x = walk(first, left);
+  if (x == v) {
+    return false;  // Componente inteira é um ciclo de vértices internos.
+  }
+  const size_t y = walk(second, right);
+
+  const size_t k = left.size() + 1 + right.size();
+  if (k < CHAIN_MIN_LENGTH) {
+    return false;
+  }
+
+  std::vector<size_t> path(left.rbegin(), left.rend());
+  path.push_back(v);
+  path.insert(path.end(), right.begin(), right.end());
+
+  // Encurta de 3 em 3 até sobrar entre 7 e 9 vértices.
+  const size_t rounds = (k - (CHAIN_MIN_LENGTH - CHAIN_PERIOD)) / CHAIN_PERIOD;
+  const size_t kept = k - rounds * CHAIN_PERIOD;
+  for (size_t i = kept; i < k; ++i) {
+    remove_vertex(path[i]);
+  }
+  work_.add_edge(path[kept - 1], y);
+  enqueue(path[kept - 1]);
+  enqueue(y);
+
+  report_.chain_vertices += rounds * CHAIN_PERIOD;
+  report_.weight_offset += rounds * CHAIN_PERIOD_WEIGHT;
+  trail_.emplace_back(ShortenedChain{x, y, kept, std::move(path)});
+  return true;
+}
+
+bool Reducer::reduce_twins() {
+  std::vector<uint8_t> candidates(work_.order(), 0);
+  for (size_t v = 0; v < work_.order(); ++v) {
+    candidates[v] = alive_[v] != 0 && satisfied_[v] == 0 ? 1 : 0;
+  }
+
+  // Classes de gêmeos são disjuntas e remover um vértice preserva as demais classes.
+  bool changed = false;
+  for (const auto& group : twin_classes(work_, TwinType::TRUE_TWINS, candidates)) {
+    if (group.size() <= TRUE_TWINS_KEPT) {
+      continue;
+    }
+    for (size_t i = TRUE_TWINS_KEPT; i < group.size(); ++i) {
+      ++report_.true_twins;
+      fix(group[i], 0);
+    }
+    changed = true;
+  }
+
+  for (const auto& group : twin_classes(work_, TwinType::FALSE_TWINS, candidates)) {
+    if (group.size() <= FALSE_TWINS_KEPT) {
+      continue;
+    }
+    FalseTwinClass twins;
+    twins.kept.assign(group.begin(), group.begin() + FALSE_TWINS_KEPT);
+    twins.removed.assign(group.begin() + FALSE_TWINS_KEPT, group.end());
+    const auto neighbors = work_.neighbors_span(group.front());
+    twins.neighborhood.assign(neighbors.begin(), neighbors.end());
+    for (size_t v : twins.removed) {
+      remove_vertex(v);
+    }
+    report_.false_twins += twins.removed.size();
+    trail_.emplace_back(std::move(twins));
+    changed = true;
+  }
+
+  return changed;
+}
+
+void Reducer::build_kernel() {
+  std::vector<size_t> removed;
+  for (size_t v = 0; v < work_.order(); ++v) {
+    if (alive_[v] == 0) {
+      removed.push_back(v);
+    }
+  }
+
+  // O grafo de trabalho não é mais usado: compactá-lo no lugar dá o kernel
+  kernel_ = std::move(work_);
+  const std::vector<size_t> original_to_kernel = kernel_.remove_vertices(removed);
+
+  kernel_to_original_.assign(kernel_.order(), 0);
+  kernel_satisfied_.assign(kernel_.order(), 0);
+  for (size_t v = 0; v < original_to_kernel.size(); ++v) {
+    if (original_to_kernel[v] != Graph::REMOVED_VERTEX) {
+      kernel_to_original_[original_to_kernel[v]] = v;
+      kernel_satisfied_[original_to_kernel[v]] = satisfied_[v];
+    }
+  }
+
+  report_.kernel_vertices = kernel_.order();
+  report_.kernel_edges = kernel_.num_edges();
+}
+
+void Reducer::reduce() {
+  if (reduced_) {
+    throw std::logic_error("Reducer::reduce: redução já aplicada");
+  }
+  reduced_ = true;
+
+  for (size_t v = 0; v < work_.order(); ++v) {
+    enqueue(v);
+  }
+
+  do {
+    while (!worklist_.empty()) {
+      const size_t v = worklist_.back();
+      worklist_.pop_back();
+      queued_[v] = 0;
+      reduce_vertex(v);
+    }
+  } while (reduce_twins());
+
+  build_kernel();
+}
+
+Labeling Reducer::lift(std::span<const uint8_t> kernel_labels) const {
+  if (kernel_labels.size() != kernel_to_original_.size()) {
+    throw std::invalid_argument("Reducer::lift: rotulação com tamanho diferente do kernel");
+  }
+
+  Labeling labels(report_.original_vertices, 0);
+  for (size_t i = 0; i < kernel_labels.size(); ++i) {
+    labels[kernel_to_original_[i]] = kernel_labels[i];
+  }
+
+  // Cada passo transforma uma solução do grafo após a regra em uma do grafo antes dela.
+  for (auto it = trail_.rbegin(); it != trail_.rend(); ++it) {
+    if (const auto* fixed = std::get_if<FixedLabel>(&*it)) {
+      labels[fixed->vertex] = fixed->label;
+    } else if (const auto* twins = std::get_if<FalseTwinClass>(&*it)) {
+      size_t supply = 0;
+      for (size_t w : twins->neighborhood) {
+        supply += labels[w];
+      }
+      if (supply < MAX_LABEL) {
+        // Eleva f(N) para 3 e concentra os rótulos dos gêmeos em um só; com 4 gêmeos isso não piora.
+        for (size_t w : twins->neighborhood) {
+          const size_t add = std::min<size_t>(MAX_LABEL - labels[w], MAX_LABEL - supply);
+          labels[w] = static_cast<uint8_t>(labels[w] + add);
+          supply += add;
+        }
+        size_t total = 0;
+        for (size_t t : twins->kept) {
+          total += labels[t];
+          labels[t] = 0;
+        }
+        labels[twins->kept.front()] = static_cast<uint8_t>(std::min<size_t>(total, MAX_LABEL));
+      }
+      for (size_t t : twins->removed) {
+        labels[t] = 0;
+      }
+    } else {
+      const auto& chain = std::get<ShortenedChain>(*it);
+      solve_chain(chain.path, labels[chain.x], labels[chain.y], labels[chain.path.front()],
+                  labels[chain.path[chain.kept - 1]], labels);
+    }
+  }
+
+  return labels;
+}
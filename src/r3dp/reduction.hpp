@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include "common/graph.hpp"
+#include "r3dp/labeling.hpp"
+
+/// @brief Resumo de uma execução do motor de redução.
+struct ReductionReport {
+  size_t original_vertices = 0;
+  size_t original_edges = 0;
+  size_t kernel_vertices = 0;
+  size_t kernel_edges = 0;
+  size_t weight_offset = 0;  ///< γR3(G) = γR3(kernel) + weight_offset
+
+  size_t isolated = 0;           ///< Vértices isolados rotulados diretamente
+  size_t satisfied_leaves = 0;   ///< Folhas já atendidas removidas com rótulo 0
+  size_t satisfied_edges = 0;    ///< Arestas entre vértices já atendidos removidas
+  size_t supports = 0;           ///< Suportes com duas ou mais folhas fixados em 3
+  size_t true_twins = 0;         ///< Gêmeos verdadeiros removidos
+  size_t false_twins = 0;        ///< Gêmeos falsos removidos
+  size_t chain_vertices = 0;     ///< Vértices removidos ao encurtar cadeias de grau 2
+
+  /// @brief Fração dos vértices eliminados pela redução.
+  /// @return Valor entre 0.0 e 1.0.
+  [[nodiscard]] double vertex_reduction() const noexcept;
+
+  /// @brief Fração das arestas eliminadas pela redução.
+  /// @return Valor entre 0.0 e 1.0.
+  [[nodiscard]] double edge_reduction() const noexcept;
+};
+
+/// @brief Motor de regras de redução seguras (kernelização) para o R3DP.
+///
+/// As regras são aplicadas com uma lista de trabalho até o ponto fixo. Vértices vizinhos de um vértice
+/// fixado em 3 passam a ser "atendidos": não têm demanda, mas continuam podendo atender os vizinhos.
+///
+/// Regras:
+/// - Vértice isolado: rótulo 2 (ou 0 se atendido).
+/// - Vértice atendido de grau 1: rótulo 0.
+/// - Aresta entre dois vértices atendidos: removida.
+/// - Suporte com duas ou mais folhas não atendidas: suporte 3, folhas 0.
+/// - Gêmeos verdadeiros (N[u] = N[v]) não atendidos: mantém 2 por classe.
+/// - Gêmeos falsos (N(u) = N(v)) não atendidos: mantém 4 por classe.
+/// - Cadeia com k >= 10 vértices de grau 2 não atendidos: remove 3 vértices e soma 3 ao peso
+///   (as tabelas de custo da cadeia de comprimento k e k - 3 diferem exatamente de 3).
+///
+/// Cada regra registra uma entrada na trilha de desfazer; lift() percorre a trilha ao contrário e
+/// transforma uma solução do kernel em uma solução do grafo original com peso no máximo
+/// w(kernel) + weight_offset, logo soluções ótimas do kernel viram soluções ótimas do original.
+class Reducer {
+ private:
+  /// Rótulo fixado de um vértice removido.
+  struct FixedLabel {
+    size_t vertex;
+    uint8_t label;
+  };
+
+  /// Classe de gêmeos falsos parcialmente removida; a vizinhança comum é guardada para o lift.
+  struct FalseTwinClass {
+    std::vector<size_t> kept;
+    std::vector<size_t> removed;
+    std::vector<size_t> neighborhood;
+  };
+
+  /// Cadeia x - path[0] - ... - path[k-1] - y encurtada para os primeiros kept vértices.
+  struct ShortenedChain {
+    size_t x;
+    size_t y;
+    size_t kept;
+    std::vector<size_t> path;
+  };
+
+  using TrailEntry = std::variant<FixedLabel, FalseTwinClass, ShortenedChain>;
+
+  Graph work_;
+  std::vector<uint8_t> alive_;
+  std::vector<uint8_t> satisfied_;
+  std::vector<TrailEntry> trail_;
+  std::vector<size_t> worklist_;
+  std::vector<uint8_t> queued_;
+
+  Graph kernel_;
+  std::vector<uint8_t> kernel_satisfied_;
+  std::vector<size_t> kernel_to_original_;
+  ReductionReport report_;
+  bool reduced_ = false;  ///< reduce() já foi chamado (o grafo de trabalho virou o kernel)
+
+  void enqueue(size_t v);
+  void fix(size_t v, uint8_t label);
+  void remove_vertex(size_t v);
+
+  bool reduce_vertex(size_t v);
+  bool reduce_support(size_t s);
+  bool reduce_chain(size_t v);
+  bool reduce_twins();
+  void build_kernel();
+
+ public:
+  /// @brief Prepara a redução de uma cópia do grafo.
+  /// @param graph Grafo original.
+  explicit Reducer(const Graph& graph);
+
+  /// @brief Aplica as regras até o ponto fixo e constrói o kernel.
+  /// @throws std::logic_error Se chamado mais de uma vez: o grafo de trabalho é compactado no lugar para
+  /// virar o kernel.
+  void reduce();
+
+  /// @brief Grafo reduzido, com vértices renumerados de 0 a k-1.
+  [[nodiscard]] const Graph& kernel() const noexcept { return kernel_; }
+
+  /// @brief Vértices do kernel já atendidos (usar como satisfied nos resolvedores).
+  [[nodiscard]] const std::vector<uint8_t>& kernel_satisfied() const noexcept { return kernel_satisfied_; }
+
+  /// @brief Vértice original correspondente a cada vértice do kernel.
+  [[nodiscard]] const std::vector<size_t>& kernel_to_original() const noexcept { return kernel_to_original_; }
+
+  /// @brief Estatísticas da redução.
+  [[nodiscard]] const ReductionReport& report() const noexcept { return report_; }
+
+  /// @brief Transforma uma solução do kernel em solução do grafo original.
+  /// @param kernel_labels Rotulação Roman {3}-dominante do kernel (respeitando kernel_satisfied()).
+  /// @return Rotulação do grafo original com peso no máximo w(kernel_labels) + report().weight_offset.
+  /// @throws std::invalid_argument Se o tamanho de kernel_labels diferir da ordem do kernel.
+  [[nodiscard]] Labeling lift(std::span<const uint8_t> kernel_labels) const;
+};
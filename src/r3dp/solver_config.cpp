@@ -0,0 +1,49 @@
+#include "r3dp/solver_config.hpp"
+
+#include "r3dp/lower_bounds.hpp"
+
+namespace {
+
+/// Acima deste número de vértices, min-fill fica caro demais e min-degree é usado.
+constexpr size_t MIN_FILL_VERTEX_LIMIT = 20000;
+
+/// Instâncias até este tamanho sempre tentam a DP exata.
+constexpr size_t SMALL_INSTANCE = 40;
+
+/// Grau médio e agrupamento máximos para tentar a DP por largura em instâncias maiores.
+constexpr double SPARSE_AVERAGE_DEGREE = 4.0;
+constexpr double SPARSE_MAX_CLUSTERING = 0.3;
+
+/// Acima deste número de vértices, o subgradiente usa um terço das iterações.
+constexpr size_t LARGE_INSTANCE = 100000;
+
+}  // namespace
+
+SolverConfig select_solver_config(const GraphProfile& profile) {
+  SolverConfig config;
+  config.subgradient_iterations = profile.vertices > LARGE_INSTANCE ? DEFAULT_SUBGRADIENT_ITERATIONS / 3
+                                                                    : DEFAULT_SUBGRADIENT_ITERATIONS;
+
+  if (profile.is_forest()) {
+    config.exact = ExactStrategy::TREE_DP;
+    config.reduce = false;
+    config.split_tree_components = false;
+    return config;
+  }
+
+  config.split_tree_components = profile.num_components > 1;
+  config.heuristic = profile.vertices <= MIN_FILL_VERTEX_LIMIT ? EliminationHeuristic::MIN_FILL
+                                                               : EliminationHeuristic::MIN_DEGREE;
+
+  const bool sparse =
+      profile.average_degree <= SPARSE_AVERAGE_DEGREE && profile.average_clustering <= SPARSE_MAX_CLUSTERING;
+  config.exact = profile.vertices <= SMALL_INSTANCE || sparse ? ExactStrategy::TREEWIDTH_DP : ExactStrategy::NONE;
+  return config;
+}
+
+bool confirm_treewidth_dp(SolverConfig& config, size_t width, size_t max_table_size) {
+  if (config.exact == ExactStrategy::TREEWIDTH_DP && !fits_table_limit(width, max_table_size)) {
+    config.exact = ExactStrategy::NONE;
+  }
+  return config.exact == ExactStrategy::TREEWIDTH_DP;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+#include "common/graph_profile.hpp"
+#include "common/tree_decomposition.hpp"
+#include "r3dp/treewidth_dp.hpp"
+
+/// @brief Resolvedor exato indicado para uma instância.
+enum class ExactStrategy {
+  TREE_DP,       ///< Floresta: DP linear em árvores
+  TREEWIDTH_DP,  ///< Esparso: DP sobre decomposição em árvore (confirmar com confirm_treewidth_dp())
+  NONE,          ///< Denso demais: usar apenas heurísticas e limitantes
+};
+
+/// @brief Configuração dos resolvedores escolhida a partir do perfil da instância.
+struct SolverConfig {
+  ExactStrategy exact = ExactStrategy::TREEWIDTH_DP;
+  bool reduce = true;                 ///< Aplicar o Reducer antes de resolver
+  bool split_tree_components = true;  ///< Resolver à parte as componentes acíclicas
+  EliminationHeuristic heuristic = EliminationHeuristic::MIN_FILL;
+  size_t subgradient_iterations = 0;  ///< Iterações para lp_lower_bound()
+};
+
+/// @brief Escolhe a configuração dos resolvedores para uma instância.
+///
+/// - Florestas vão direto para a DP em árvores, sem redução.
+/// - Componentes acíclicas só são separadas se houver mais de uma componente.
+/// - MIN_FILL é usado até MIN_FILL_VERTEX_LIMIT vértices; acima disso, MIN_DEGREE (mais barato).
+/// - A DP por largura só é indicada para grafos pequenos ou esparsos com pouco agrupamento, já que
+///   triângulos em excesso indicam bolsas grandes. A indicação ainda depende da largura real: ver
+///   confirm_treewidth_dp().
+/// - O subgradiente recebe menos iterações em instâncias muito grandes.
+///
+/// @param profile Perfil calculado por profile_graph().
+/// @return Configuração sugerida.
+[[nodiscard]] SolverConfig select_solver_config(const GraphProfile& profile);
+
+/// @brief Confirma a DP por largura depois de decompor o grafo a resolver.
+///
+/// O perfil só diz se vale a pena decompor; a DP é viável apenas se a tabela da maior bolsa couber
+/// em max_table_size (fits_table_limit()). Caso contrário, exact passa a NONE e restam os limitantes.
+///
+/// @param config Configuração a ajustar.
+/// @param width Largura da decomposição obtida com config.heuristic.
+/// @param max_table_size Maior tabela permitida (em entradas).
+/// @return true se exact continua TREEWIDTH_DP.
+bool confirm_treewidth_dp(SolverConfig& config, size_t width, size_t max_table_size = DEFAULT_MAX_TABLE_SIZE);
@@ -0,0 +1,208 @@
+#include "r3dp/tree_dp.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t INF = std::numeric_limits<uint32_t>::max() / 4;
+constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+constexpr size_t NUM_LABELS = MAX_LABEL + 1;  ///< Rótulos 0..3
+constexpr size_t NUM_SUMS = MAX_LABEL + 1;    ///< Somas recebidas saturadas em 0..3
+
+/// Tabela dp[f * NUM_SUMS + c] de um vértice.
+using Table = std::array<uint32_t, NUM_LABELS * NUM_SUMS>;
+using SumRow = std::array<uint32_t, NUM_SUMS>;
+
+constexpr uint8_t saturate(size_t sum) noexcept { return static_cast<uint8_t>(std::min<size_t>(sum, MAX_LABEL)); }
+
+/// @brief Programação dinâmica do R3DP sobre uma árvore enraizada.
+///
+/// dp[v][f][c] é o menor peso da subárvore de v com f(v) = f, soma saturada dos rótulos dos filhos
+/// igual a c e todos os descendentes atendidos. A demanda de v só é verificada no pai, que conhece f(pai).
+class TreeSolver {
+ private:
+  const Graph& graph_;
+  std::span<const uint8_t> satisfied_;
+  std::vector<Table> dp_;
+  std::vector<size_t> parent_;
+  std::vector<uint8_t> sum_;     ///< Soma escolhida dos filhos na reconstrução
+  std::vector<size_t> order_;    ///< Ordem BFS da árvore corrente
+  std::vector<size_t> children_;
+  std::vector<SumRow> prefix_;   ///< Mochila parcial sobre os filhos de um vértice
+
+  /// Menor custo da subárvore de u com f(u) = fu, dado que o pai tem rótulo f.
+  [[nodiscard]] uint32_t best_child(size_t u, uint8_t f, uint8_t fu) const noexcept {
+    uint32_t best = INF;
+    for (size_t cu = 0; cu < NUM_SUMS; ++cu) {
+      if (cu + f >= vertex_demand(satisfied_, u, fu)) {
+        best = std::min(best, dp_[u][fu * NUM_SUMS + cu]);
+      }
+    }
+    return best;
+  }
+
+  /// Preenche prefix_[0..k] com a mochila sobre children_ quando o vértice tem rótulo f.
+  void fill_prefix(uint8_t f) {
+    prefix_.resize(children_.size() + 1);
+    prefix_[0].fill(INF);
+    prefix_[0][0] = 0;
+
+    for (size_t i = 0; i < children_.size(); ++i) {
+      SumRow& next = prefix_[i + 1];
+      next.fill(INF);
+      for (size_t c = 0; c < NUM_SUMS; ++c) {
+        if (prefix_[i][c] == INF) {
+          continue;
+        }
+        for (uint8_t fu = 0; fu < NUM_LABELS; ++fu) {
+          const uint32_t cost = best_child(children_[i], f, fu);
+          if (cost == INF) {
+            continue;
+          }
+          uint32_t& slot = next[saturate(c + fu)];
+          slot = std::min(slot, prefix_[i][c] + cost);
+        }
+      }
+    }
+  }
+
+  void collect_children(size_t v) {
+    children_.clear();
+    for (size_t u : graph_.neighbors_span(v)) {
+      if (u != parent_[v]) {
+        children_.push_back(u);
+      }
+    }
+  }
+
+ public:
+  TreeSolver(const Graph& graph, std::span<const uint8_t> satisfied)
+      : graph_(graph),
+        satisfied_(satisfied),
+        dp_(graph.order()),
+        parent_(graph.order(), NO_PARENT),
+        sum_(graph.order(), 0) {}
+
+  /// Resolve a árvore que contém root e escreve os rótulos em labels. Retorna o peso ótimo.
+  size_t solve(size_t root, Labeling& labels) {
+    order_.clear();
+    order_.push_back(root);
+    parent_[root] = NO_PARENT;
+    for (size_t i = 0; i < order_.size(); ++i) {
+      const size_t v = order_[i];
+      for (size_t u : graph_.neighbors_span(v)) {
+        if (u != parent_[v]) {
+          parent_[u] = v;
+          order_.push_back(u);
+        }
+      }
+    }
+
+    // Ordem BFS invertida: filhos sempre antes dos pais.
+    for (size_t i = order_.size(); i-- > 0;) {
+      const size_t v = order_[i];
+      collect_children(v);
+      for (uint8_t f = 0; f < NUM_LABELS; ++f) {
+        fill_prefix(f);
+        for (size_t c = 0; c < NUM_SUMS; ++c) {
+          const uint32_t cost = prefix_.back()[c];
+          dp_[v][f * NUM_SUMS + c] = cost == INF ? INF : cost + f;
+        }
+      }
+    }
+
+    uint32_t best = INF;
+    for (uint8_t f = 0; f < NUM_LABELS; ++f) {
+      for (uint8_t c = vertex_demand(satisfied_, root, f); c < NUM_SUMS; ++c) {
+        if (dp_[root][f * NUM_SUMS + c] < best) {
+          best = dp_[root][f * NUM_SUMS + c];
+          labels[root] = f;
+          sum_[root] = c;
+        }
+      }
+    }
+
+    // Reconstrução de cima para baixo refazendo a mochila de cada vértice.
+    for (const size_t v : order_) {
+      const uint8_t f = labels[v];
+      collect_children(v);
+      fill_prefix(f);
+
+      uint8_t target = sum_[v];
+      for (size_t i = children_.size(); i-- > 0;) {
+        const size_t u = children_[i];
+        bool found = false;
+        for (uint8_t c = 0; c < NUM_SUMS && !found; ++c) {
+          if (prefix_[i][c] == INF) {
+            continue;
+          }
+          for (uint8_t fu = 0; fu < NUM_LABELS && !found; ++fu) {
+            const uint32_t cost = best_child(u, f, fu);
+            if (cost == INF || saturate(c + fu) != target || prefix_[i][c] + cost != prefix_[i + 1][target]) {
+              continue;
+            }
+            labels[u] = fu;
+            for (uint8_t cu = 0; cu < NUM_SUMS; ++cu) {
+              if (cu + f >= vertex_demand(satisfied_, u, fu) && dp_[u][fu * NUM_SUMS + cu] == cost) {
+                sum_[u] = cu;
+                break;
+              }
+            }
+            target = c;
+            found = true;
+          }
+        }
+      }
+    }
+
+    return best;
+  }
+};
+
+}  // namespace
+
+bool is_tree_component(const Graph& graph, const std::vector<size_t>& component) {
+  size_t degree_sum = 0;
+  for (size_t v : component) {
+    degree_sum += graph.degree(v);
+  }
+  return degree_sum / 2 + 1 == component.size();
+}
+
+Labeling solve_forest(const Graph& graph, std::span<const uint8_t> satisfied) {
+  const auto components = graph.get_all_connected_components();
+  for (const auto& component : components) {
+    if (!is_tree_component(graph, component)) {
+      throw std::invalid_argument("solve_forest: o grafo contém ciclo");
+    }
+  }
+
+  Labeling labels(graph.order(), 0);
+  TreeSolver solver(graph, satisfied);
+  for (const auto& component : components) {
+    solver.solve(component.front(), labels);
+  }
+  return labels;
+}
+
+PartialLabeling solve_tree_components(const Graph& graph, std::span<const uint8_t> satisfied) {
+  PartialLabeling result;
+  result.labels.assign(graph.order(), 0);
+  result.fixed.assign(graph.order(), 0);
+
+  TreeSolver solver(graph, satisfied);
+  for (const auto& component : graph.get_all_connected_components()) {
+    if (!is_tree_component(graph, component)) {
+      continue;
+    }
+    result.weight += solver.solve(component.front(), result.labels);
+    for (size_t v : component) {
+      result.fixed[v] = 1;
+    }
+    result.num_fixed += component.size();
+  }
+  return result;
+}
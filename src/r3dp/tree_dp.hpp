@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "common/graph.hpp"
+#include "r3dp/labeling.hpp"
+
+/// @brief Solução parcial em que apenas parte dos vértices teve o rótulo fixado.
+struct PartialLabeling {
+  Labeling labels;              ///< Rótulo de cada vértice (0 para os não fixados)
+  std::vector<uint8_t> fixed;   ///< fixed[v] != 0 se o rótulo de v já é ótimo
+  size_t num_fixed = 0;         ///< Quantidade de vértices fixados
+  size_t weight = 0;            ///< Peso dos vértices fixados
+};
+
+/// @brief Verifica se a componente é uma árvore (arestas == vértices - 1).
+/// @param graph Grafo.
+/// @param component Vértices da componente conexa.
+/// @return true se a componente é acíclica.
+[[nodiscard]] bool is_tree_component(const Graph& graph, const std::vector<size_t>& component);
+
+/// @brief Resolve exatamente o R3DP em uma floresta em tempo O(n).
+///
+/// Programação dinâmica em pós-ordem iterativa: para cada vértice v guarda o menor peso da subárvore
+/// dado o rótulo de v e a soma (saturada em 3) recebida dos filhos. A reconstrução é feita de cima
+/// para baixo, sem recursão, para suportar caminhos longos.
+///
+/// @param graph Grafo acíclico.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @return Rotulação Roman {3}-dominante de peso mínimo.
+/// @throws std::invalid_argument Se o grafo contiver ciclo.
+[[nodiscard]] Labeling solve_forest(const Graph& graph, std::span<const uint8_t> satisfied = {});
+
+/// @brief Resolve exatamente todas as componentes que são árvores.
+///
+/// Componentes com ciclo permanecem não fixadas e devem ser resolvidas por outro método. Como as
+/// componentes são independentes, a solução ótima do grafo inteiro é a união das ótimas por componente.
+///
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @return Rotulação parcial com as componentes acíclicas resolvidas.
+[[nodiscard]] PartialLabeling solve_tree_components(const Graph& graph, std::span<const uint8_t> satisfied = {});
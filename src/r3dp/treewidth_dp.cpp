@@ -0,0 +1,370 @@
+#include "r3dp/treewidth_dp.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t INF = std::numeric_limits<uint32_t>::max() / 4;
+constexpr size_t RADIX = 9;  ///< Estados (rótulo, recebido) por vértice da bolsa
+
+constexpr std::array<uint8_t, RADIX> DIGIT_LABEL = {0, 0, 0, 0, 1, 1, 1, 2, 3};
+constexpr std::array<uint8_t, RADIX> DIGIT_RECEIVED = {0, 1, 2, 3, 0, 1, 2, 0, 0};
+constexpr std::array<uint8_t, MAX_LABEL + 1> FIRST_DIGIT = {0, 4, 7, 8};
+
+/// Dígito do estado (label, received), com received saturado na demanda do rótulo.
+constexpr uint8_t digit_of(uint8_t label, size_t received) noexcept {
+  return static_cast<uint8_t>(FIRST_DIGIT[label] + std::min<size_t>(received, label_demand(label)));
+}
+
+using Digits = std::vector<uint8_t>;
+
+/// @brief DP do R3DP sobre uma decomposição "nice", com reconstrução da solução.
+class NiceSolver {
+ private:
+  const Graph& graph_;
+  const NiceTreeDecomposition& nice_;
+  std::span<const uint8_t> satisfied_;
+  std::vector<std::vector<uint32_t>> tables_;
+  std::vector<size_t> pow_;
+  std::vector<char> mark_;
+
+  static void decode(size_t index, size_t count, Digits& digits) {
+    digits.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      digits[i] = static_cast<uint8_t>(index % RADIX);
+      index /= RADIX;
+    }
+  }
+
+  [[nodiscard]] size_t encode(const Digits& digits) const noexcept {
+    size_t index = 0;
+    for (size_t i = 0; i < digits.size(); ++i) {
+      index += digits[i] * pow_[i];
+    }
+    return index;
+  }
+
+  [[nodiscard]] static size_t position(const std::vector<size_t>& bag, size_t v) noexcept {
+    return static_cast<size_t>(std::lower_bound(bag.begin(), bag.end(), v) - bag.begin());
+  }
+
+  /// Posições da bolsa adjacentes a v.
+  [[nodiscard]] std::vector<char> adjacency_in_bag(const std::vector<size_t>& bag, size_t v) {
+    for (size_t u : graph_.neighbors_span(v)) {
+      mark_[u] = 1;
+    }
+    std::vector<char> adjacent(bag.size(), 0);
+    for (size_t j = 0; j < bag.size(); ++j) {
+      adjacent[j] = mark_[bag[j]];
+    }
+    for (size_t u : graph_.neighbors_span(v)) {
+      mark_[u] = 0;
+    }
+    return adjacent;
+  }
+
+  /// Esquece a posição p (vértice v): verifica a demanda de v e repassa seu rótulo aos vizinhos na bolsa.
+  bool forget_state(const Digits& child, size_t p, size_t v, const std::vector<char>& adjacent, Digits& parent) const {
+    const uint8_t label = DIGIT_LABEL[child[p]];
+    size_t total = DIGIT_RECEIVED[child[p]];
+    for (size_t j = 0; j < child.size(); ++j) {
+      if (j != p && adjacent[j] != 0) {
+        total += DIGIT_LABEL[child[j]];
+      }
+    }
+    if (total < vertex_demand(satisfied_, v, label)) {
+      return false;
+    }
+
+    parent.clear();
+    for (size_t j = 0; j < child.size(); ++j) {
+      if (j == p) {
+        continue;
+      }
+      uint8_t digit = child[j];
+      if (adjacent[j] != 0) {
+        digit = digit_of(DIGIT_LABEL[digit], DIGIT_RECEIVED[digit] + label);
+      }
+      parent.push_back(digit);
+    }
+    return true;
+  }
+
+  /// Soma dos rótulos dos vértices da bolsa.
+  static uint32_t bag_weight(const Digits& digits) noexcept {
+    uint32_t weight = 0;
+    for (uint8_t digit : digits) {
+      weight += DIGIT_LABEL[digit];
+    }
+    return weight;
+  }
+
+  /// Memória reutilizada pela enumeração de decomposições de um estado.
+  struct SplitScratch {
+    Digits digits;
+    std::vector<size_t> step;   ///< 9^j das posições com recebido > 0
+    std::vector<uint8_t> limit; ///< Recebido de x nessas posições
+    std::vector<uint8_t> part;  ///< Parte atribuída a y
+  };
+
+  /// Chama fn(y, z) para cada par de estados cujas quantidades recebidas somam exatamente as de x.
+  /// A enumeração para quando fn retorna true.
+  template <typename Fn>
+  void for_each_split(size_t x, size_t count, SplitScratch& scratch, Fn&& fn) const {
+    decode(x, count, scratch.digits);
+    scratch.step.clear();
+    scratch.limit.clear();
+    size_t base = 0;
+    for (size_t j = 0; j < count; ++j) {
+      const uint8_t digit = scratch.digits[j];
+      base += FIRST_DIGIT[DIGIT_LABEL[digit]] * pow_[j];
+      if (DIGIT_RECEIVED[digit] > 0) {
+        scratch.step.push_back(pow_[j]);
+        scratch.limit.push_back(DIGIT_RECEIVED[digit]);
+      }
+    }
+
+    // Odômetro sobre a parte recebida de y em cada posição; z é o complemento.
+    const size_t free_count = scratch.step.size();
+    scratch.part.assign(free_count, 0);
+    size_t y = base;
+    while (true) {
+      if (fn(y, x + base - y)) {
+        return;
+      }
+      size_t i = 0;
+      for (; i < free_count; ++i) {
+        if (scratch.part[i] < scratch.limit[i]) {
+          ++scratch.part[i];
+          y += scratch.step[i];
+          break;
+        }
+        y -= scratch.part[i] * scratch.step[i];
+        scratch.part[i] = 0;
+      }
+      if (i == free_count) {
+        return;
+      }
+    }
+  }
+
+  /// Propaga "recebeu pelo menos r": T[r] = min(T[r], T[r + 1]) em cada coordenada.
+  void close_upwards(std::vector<uint32_t>& table, size_t count) const {
+    for (size_t j = 0; j < count; ++j) {
+      for (size_t index = table.size(); index-- > 0;) {
+        const uint8_t digit = (index / pow_[j]) % RADIX;
+        if (DIGIT_RECEIVED[digit] < label_demand(DIGIT_LABEL[digit])) {
+          table[index] = std::min(table[index], table[index + pow_[j]]);
+        }
+      }
+    }
+  }
+
+  void compute(size_t t) {
+    const NiceNode& node = nice_.nodes[t];
+    const size_t count = node.bag.size();
+    auto& table = tables_[t];
+    table.assign(pow_[count], INF);
+    Digits digits;
+
+    switch (node.type) {
+      case NiceNodeType::LEAF:
+        table[0] = 0;
+        break;
+
+      case NiceNodeType::INTRODUCE: {
+        const auto& child = tables_[node.left];
+        const size_t p = position(node.bag, node.vertex);
+        for (size_t label = 0; label <= MAX_LABEL; ++label) {
+          const size_t offset = FIRST_DIGIT[label] * pow_[p];
+          for (size_t ci = 0; ci < child.size(); ++ci) {
+            if (child[ci] == INF) {
+              continue;
+            }
+            const size_t low = ci % pow_[p];
+            const size_t high = ci / pow_[p];
+            table[low + offset + high * pow_[p + 1]] = child[ci] + static_cast<uint32_t>(label);
+          }
+        }
+        break;
+      }
+
+      case NiceNodeType::FORGET: {
+        const auto& child_bag = nice_.nodes[node.left].bag;
+        const auto& child = tables_[node.left];
+        const size_t p = position(child_bag, node.vertex);
+        const auto adjacent = adjacency_in_bag(child_bag, node.vertex);
+        Digits parent;
+        for (size_t ci = 0; ci < child.size(); ++ci) {
+          if (child[ci] == INF) {
+            continue;
+          }
+          decode(ci, child_bag.size(), digits);
+          if (forget_state(digits, p, node.vertex, adjacent, parent)) {
+            uint32_t& slot = table[encode(parent)];
+            slot = std::min(slot, child[ci]);
+          }
+        }
+        close_upwards(table, count);
+        break;
+      }
+
+      case NiceNodeType::JOIN: {
+        const auto& left = tables_[node.left];
+        const auto& right = tables_[node.right];
+        const auto size = static_cast<int64_t>(table.size());
+#pragma omp parallel
+        {
+          SplitScratch scratch;
+#pragma omp for schedule(dynamic, 1024)
+          for (int64_t x = 0; x < size; ++x) {
+            uint32_t best = INF;
+            for_each_split(static_cast<size_t>(x), count, scratch, [&](size_t y, size_t z) {
+              best = std::min(best, left[y] + right[z]);
+              return false;
+            });
+            // Os rótulos da bolsa foram pagos nos dois ramos.
+            table[x] = best >= INF ? INF : best - bag_weight(scratch.digits);
+          }
+        }
+        break;
+      }
+    }
+  }
+
+ public:
+  NiceSolver(const Graph& graph, const NiceTreeDecomposition& nice, std::span<const uint8_t> satisfied,
+             size_t max_table_size)
+      : graph_(graph), nice_(nice), satisfied_(satisfied), tables_(nice.nodes.size()), mark_(graph.order(), 0) {
+    size_t largest = 0;
+    for (const auto& node : nice.nodes) {
+      largest = std::max(largest, node.bag.size());
+    }
+
+    if (largest > 0 && !fits_table_limit(largest - 1, max_table_size)) {
+      throw std::length_error("solve_nice_decomposition: bolsa com " + std::to_string(largest) +
+                              " vértices excede o tamanho máximo de tabela");
+    }
+    pow_.push_back(1);
+    for (size_t i = 0; i < largest; ++i) {
+      pow_.push_back(pow_.back() * RADIX);
+    }
+  }
+
+  Labeling solve() {
+    Labeling labels(graph_.order(), 0);
+    if (nice_.nodes.empty()) {
+      return labels;
+    }
+
+    // Filhos sempre precedem os pais no vetor de nós.
+    for (size_t t = 0; t < nice_.nodes.size(); ++t) {
+      compute(t);
+    }
+
+    constexpr size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> target(nice_.nodes.size(), NONE);
+    target[nice_.root] = 0;
+    Digits digits;
+    Digits wanted;
+    Digits parent;
+
+    for (size_t t = nice_.nodes.size(); t-- > 0;) {
+      if (target[t] == NONE) {
+        continue;
+      }
+      const NiceNode& node = nice_.nodes[t];
+      const size_t x = target[t];
+      const uint32_t value = tables_[t][x];
+
+      switch (node.type) {
+        case NiceNodeType::LEAF:
+          break;
+
+        case NiceNodeType::INTRODUCE: {
+          const size_t p = position(node.bag, node.vertex);
+          target[node.left] = x % pow_[p] + (x / pow_[p + 1]) * pow_[p];
+          break;
+        }
+
+        case NiceNodeType::FORGET: {
+          const auto& child_bag = nice_.nodes[node.left].bag;
+          const auto& child = tables_[node.left];
+          const size_t p = position(child_bag, node.vertex);
+          const auto adjacent = adjacency_in_bag(child_bag, node.vertex);
+          decode(x, node.bag.size(), wanted);
+
+          for (size_t ci = 0; ci < child.size(); ++ci) {
+            if (child[ci] != value) {
+              continue;
+            }
+            decode(ci, child_bag.size(), digits);
+            if (!forget_state(digits, p, node.vertex, adjacent, parent)) {
+              continue;
+            }
+            bool covers = true;
+            for (size_t j = 0; j < parent.size() && covers; ++j) {
+              covers = DIGIT_LABEL[parent[j]] == DIGIT_LABEL[wanted[j]] &&
+                       DIGIT_RECEIVED[parent[j]] >= DIGIT_RECEIVED[wanted[j]];
+            }
+            if (covers) {
+              target[node.left] = ci;
+              labels[node.vertex] = DIGIT_LABEL[digits[p]];
+              break;
+            }
+          }
+          break;
+        }
+
+        case NiceNodeType::JOIN: {
+          const auto& left = tables_[node.left];
+          const auto& right = tables_[node.right];
+          decode(x, node.bag.size(), digits);
+          const uint32_t paid_twice = bag_weight(digits);
+          SplitScratch scratch;
+          for_each_split(x, node.bag.size(), scratch, [&](size_t y, size_t z) {
+            if (left[y] != INF && right[z] != INF && left[y] + right[z] == value + paid_twice) {
+              target[node.left] = y;
+              target[node.right] = z;
+              return true;
+            }
+            return false;
+          });
+          break;
+        }
+      }
+    }
+
+    return labels;
+  }
+};
+
+}  // namespace
+
+bool fits_table_limit(size_t width, size_t max_table_size) noexcept {
+  size_t entries = 1;
+  for (size_t i = 0; i <= width; ++i) {
+    if (entries > max_table_size / RADIX) {
+      return false;
+    }
+    entries *= RADIX;
+  }
+  return true;
+}
+
+Labeling solve_nice_decomposition(const Graph& graph, const NiceTreeDecomposition& nice,
+                                  std::span<const uint8_t> satisfied, size_t max_table_size) {
+  NiceSolver solver(graph, nice, satisfied, max_table_size);
+  return solver.solve();
+}
+
+Labeling solve_treewidth_dp(const Graph& graph, std::span<const uint8_t> satisfied, EliminationHeuristic heuristic,
+                            size_t max_table_size) {
+  return solve_nice_decomposition(graph, make_nice(decompose(graph, heuristic)), satisfied, max_table_size);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "common/graph.hpp"
+#include "common/tree_decomposition.hpp"
+#include "r3dp/labeling.hpp"
+
+/// @brief Limite padrão de entradas por tabela da DP (9^7, bolsas com até 7 vértices).
+inline constexpr size_t DEFAULT_MAX_TABLE_SIZE = 4782969;
+
+/// @brief Verifica se a DP cabe no limite de tabela para uma decomposição de largura width.
+/// @param width Largura da decomposição (maior bolsa - 1).
+/// @param max_table_size Maior tabela permitida (em entradas).
+/// @return true se 9^(width + 1) <= max_table_size, isto é, se solve_nice_decomposition() não lança
+/// std::length_error para essa largura.
+[[nodiscard]] bool fits_table_limit(size_t width, size_t max_table_size = DEFAULT_MAX_TABLE_SIZE) noexcept;
+
+/// @brief Resolve exatamente o R3DP por programação dinâmica sobre uma decomposição "nice".
+///
+/// Cada vértice da bolsa é codificado em um dígito de base 9: o rótulo f e quanto já recebeu dos
+/// vizinhos esquecidos, saturado na demanda de f (f = 0: 0..3, f = 1: 0..2, f >= 2: sem contagem).
+/// As tabelas guardam o custo mínimo para "recebeu pelo menos r", o que permite que o JOIN combine
+/// apenas decomposições exatas das somas. Cada aresta contribui no FORGET do primeiro extremo esquecido.
+///
+/// Tempo O(18^(w+1)) por JOIN e O(w * 9^(w+1)) nos demais nós, onde w é a largura.
+///
+/// @param graph Grafo.
+/// @param nice Decomposição "nice" de graph.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @param max_table_size Maior tabela permitida (em entradas).
+/// @return Rotulação Roman {3}-dominante de peso mínimo.
+/// @throws std::length_error Se alguma bolsa exigir uma tabela maior que max_table_size.
+[[nodiscard]] Labeling solve_nice_decomposition(const Graph& graph, const NiceTreeDecomposition& nice,
+                                                std::span<const uint8_t> satisfied = {},
+                                                size_t max_table_size = DEFAULT_MAX_TABLE_SIZE);
+
+/// @brief Constrói uma decomposição heurística e resolve o R3DP exatamente sobre ela.
+/// @param graph Grafo.
+/// @param satisfied Vértices já atendidos (vazio: nenhum).
+/// @param heuristic Heurística de eliminação (padrão: MIN_FILL).
+/// @param max_table_size Maior tabela permitida (em entradas).
+/// @return Rotulação Roman {3}-dominante de peso mínimo.
+/// @throws std::length_error Se a largura obtida for grande demais para max_table_size.
+[[nodiscard]] Labeling solve_treewidth_dp(const Graph& graph, std::span<const uint8_t> satisfied = {},
+                                          EliminationHeuristic heuristic = EliminationHeuristic::MIN_FILL,
+                                          size_t max_table_size = DEFAULT_MAX_TABLE_SIZE);